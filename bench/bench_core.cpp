@@ -0,0 +1,537 @@
+// Microbenchmarks de los algoritmos principales: A*, validación de torres,
+// ataques de las torres, evolución del algoritmo genético y movimiento de enemigos.
+// Cada resultado es una línea JSON en stdout (ns/op, asignaciones/op, bytes/op)
+// para poder guardar y comparar las mediciones entre versiones.
+// Uso: bench_core [--filter texto] [--min-ms N]
+#include "../src/AStar.h"
+#include "../src/FlowField.h"
+#include "../src/FloodFill.h"
+#include "../src/LPAStar.h"
+#include "../src/KShortestPaths.h"
+#include "../src/GameBoard.h"
+#include "../src/Simulation.h"
+#include "../src/GeneticAlgorithm.h"
+#include "../src/EnemyStore.h"
+#include "../src/PathRegistry.h"
+#include "../src/RandomStream.h"
+#include "../src/Logger.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+// Contadores de asignaciones: se reemplaza el operator new global
+static std::atomic<uint64_t> allocationCount(0);
+static std::atomic<uint64_t> allocatedBytes(0);
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+// GCC no sabe que operator new también está reemplazado y avisa al ver free()
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+static const char* filter = nullptr;
+static double minMs = 200.0;
+
+// Mide op() hasta acumular minMs de tiempo medido; prepare() se ejecuta antes
+// de cada op() fuera de la medición (para reponer el estado que op() consume)
+template <typename Prepare, typename Op>
+static void runBench(const char* name, const std::string& params, Prepare prepare, Op op) {
+    std::string fullName = std::string(name) + "/" + params;
+    if (filter && fullName.find(filter) == std::string::npos) {
+        return;
+    }
+
+    // Calentamiento (cachés, reservas de los contenedores reutilizables)
+    prepare();
+    op();
+
+    uint64_t iterations = 0;
+    uint64_t elapsedNs = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    const uint64_t minNs = static_cast<uint64_t>(minMs * 1e6);
+    while (elapsedNs < minNs || iterations < 10) {
+        prepare();
+
+        uint64_t allocsBefore = allocationCount.load(std::memory_order_relaxed);
+        uint64_t bytesBefore = allocatedBytes.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        op();
+        auto end = std::chrono::steady_clock::now();
+        allocations += allocationCount.load(std::memory_order_relaxed) - allocsBefore;
+        bytes += allocatedBytes.load(std::memory_order_relaxed) - bytesBefore;
+
+        elapsedNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        iterations++;
+    }
+
+    std::printf("{\"bench\":\"%s\",\"params\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.1f,"
+                "\"allocs_per_op\":%.2f,\"bytes_per_op\":%.1f}\n",
+                name, params.c_str(), static_cast<unsigned long long>(iterations),
+                static_cast<double>(elapsedNs) / iterations, static_cast<double>(allocations) / iterations,
+                static_cast<double>(bytes) / iterations);
+    std::fflush(stdout);
+}
+
+template <typename Op>
+static void runBench(const char* name, const std::string& params, Op op) {
+    runBench(name, params, [] {}, op);
+}
+
+static std::string sizeParams(int rows, int cols) {
+    return std::to_string(rows) + "x" + std::to_string(cols);
+}
+
+// A* sobre el tablero del juego (con isCellWalkable y con el mapa de celdas
+// caminables) y sobre una cuadrícula con obstáculos al azar
+static void benchAStar() {
+    const int sizes[][2] = {{12, 16}, {24, 32}, {48, 64}, {96, 128}};
+    for (const auto& size : sizes) {
+        int rows = size[0];
+        int cols = size[1];
+
+        GameBoard board(rows, cols);
+        auto boardWalkable = [&board](int x, int y) { return board.isCellWalkable(x, y); };
+        SDL_Point entrance = board.getEntrancePoint();
+        SDL_Point exit = board.getExitPoint();
+        runBench("AStar::findPath", "tablero_" + sizeParams(rows, cols), [&] {
+            std::vector<SDL_Point> path = AStar::findPath(boardWalkable, entrance, exit, cols, rows);
+            if (path.empty()) std::abort();
+        });
+        runBench("AStar::findPath", "mapa_" + sizeParams(rows, cols), [&] {
+            std::vector<SDL_Point> path = AStar::findPath(board.getWalkableMap(), entrance, exit);
+            if (path.empty()) std::abort();
+        });
+
+        // Cuadrícula abierta con un 25% de obstáculos (de esquina a esquina)
+        RandomStream rng(rows * 1000 + cols);
+        std::vector<uint8_t> blocked;
+        std::vector<SDL_Point> path;
+        SDL_Point start = {0, 0};
+        SDL_Point end = {cols - 1, rows - 1};
+        auto openWalkable = [&blocked, cols](int x, int y) { return blocked[y * cols + x] == 0; };
+        do {
+            blocked.assign(rows * cols, 0);
+            for (uint8_t& cell : blocked) {
+                cell = rng.nextFloat() < 0.25f ? 1 : 0;
+            }
+            blocked[0] = 0;
+            blocked[rows * cols - 1] = 0;
+            path = AStar::findPath(openWalkable, start, end, cols, rows);
+        } while (path.empty());
+        runBench("AStar::findPath", "obstaculos_" + sizeParams(rows, cols), [&] {
+            std::vector<SDL_Point> found = AStar::findPath(openWalkable, start, end, cols, rows);
+            if (found.empty()) std::abort();
+        });
+    }
+}
+
+// Campo de distancias hasta la salida (un cálculo por cambio del tablero)
+static void benchFlowField() {
+    const int sizes[][2] = {{12, 16}, {24, 32}, {48, 64}, {96, 128}};
+    for (const auto& size : sizes) {
+        GameBoard board(size[0], size[1]);
+        FlowField flowField;
+        runBench("FlowField::compute", sizeParams(size[0], size[1]), [&] {
+            flowField.compute(board.getWalkableMap(), board.getExitPoint());
+        });
+    }
+}
+
+// Conectividad de esquina a esquina en una cuadrícula con obstáculos: la
+// inundación por bits frente al BFS con cola del campo de distancias
+static void benchFloodFill() {
+    const int sizes[][2] = {{12, 16}, {96, 128}, {1000, 1000}};
+    for (const auto& size : sizes) {
+        int rows = size[0];
+        int cols = size[1];
+        RandomStream rng(rows * 1000 + cols);
+        WalkableBitmap walkable(rows, cols);
+        for (int cell = 0; cell < rows * cols; cell++) {
+            walkable.set(cell % cols, cell / cols, rng.nextFloat() >= 0.25f);
+        }
+        SDL_Point start = {0, 0};
+        SDL_Point end = {cols - 1, rows - 1};
+        walkable.set(start.x, start.y, true);
+        walkable.set(end.x, end.y, true);
+
+        bool connected = FloodFill::isConnected(walkable, start, end);
+        runBench("FloodFill::isConnected", "obstaculos_" + sizeParams(rows, cols), [&] {
+            if (FloodFill::isConnected(walkable, start, end) != connected) std::abort();
+        });
+
+        WalkableBitmap reached;
+        runBench("FloodFill::fill", "obstaculos_" + sizeParams(rows, cols), [&] {
+            FloodFill::fill(walkable, start, reached);
+        });
+
+        FlowField flowField;
+        runBench("FlowField::compute", "obstaculos_" + sizeParams(rows, cols), [&] {
+            flowField.compute(walkable, start);
+        });
+    }
+}
+
+// Reparación incremental tras cambiar una celda (como al colocar una torre) en
+// una cuadrícula con obstáculos; el A* completo equivalente es AStar::findPath/obstaculos_*
+static void benchIncrementalPath() {
+    const int sizes[][2] = {{12, 16}, {24, 32}, {48, 64}, {96, 128}};
+    for (const auto& size : sizes) {
+        int rows = size[0];
+        int cols = size[1];
+        RandomStream rng(rows * 1000 + cols);
+        WalkableBitmap walkable(rows, cols);
+        for (int cell = 0; cell < rows * cols; cell++) {
+            walkable.set(cell % cols, cell / cols, rng.nextFloat() >= 0.25f);
+        }
+        SDL_Point start = {0, 0};
+        SDL_Point end = {cols - 1, rows - 1};
+        walkable.set(start.x, start.y, true);
+        walkable.set(end.x, end.y, true);
+
+        LPAStar planner;
+        std::vector<SDL_Point> path;
+        uint32_t version = 1;
+        planner.findPath(walkable, version, start, end, path);
+
+        // Cada operación deshace el cambio anterior y cambia otra celda al azar
+        // (ni el inicio ni el destino), así la densidad de obstáculos se mantiene
+        int changed = -1;
+        auto toggle = [&walkable, cols](int cell) {
+            walkable.set(cell % cols, cell / cols, !walkable(cell % cols, cell / cols));
+        };
+        runBench("LPAStar::findPath", "cambio_" + sizeParams(rows, cols),
+                 [&] {
+                     if (changed != -1) {
+                         toggle(changed);
+                     }
+                     changed = rng.nextInt(1, rows * cols - 2);
+                     toggle(changed);
+                     version++;
+                 },
+                 [&] { planner.findPath(walkable, version, start, end, path); });
+    }
+}
+
+// Caminos alternativos (Yen) en una cuadrícula con obstáculos, en un hilo y
+// en todos; cada operación cambia la versión del mapa para no usar la caché
+static void benchAlternativePaths() {
+    const int sizes[][2] = {{24, 32}, {96, 128}, {256, 256}};
+    for (const auto& size : sizes) {
+        int rows = size[0];
+        int cols = size[1];
+        RandomStream rng(rows * 1000 + cols);
+        WalkableBitmap walkable(rows, cols);
+        for (int cell = 0; cell < rows * cols; cell++) {
+            walkable.set(cell % cols, cell / cols, rng.nextFloat() >= 0.25f);
+        }
+        SDL_Point start = {0, 0};
+        SDL_Point end = {cols - 1, rows - 1};
+        walkable.set(start.x, start.y, true);
+        walkable.set(end.x, end.y, true);
+        std::vector<SDL_Point> mainPath = AStar::findPath(walkable, start, end);
+        if (mainPath.empty()) std::abort();
+
+        const int threadCounts[] = {1, 0};
+        for (int threads : threadCounts) {
+            KShortestPaths planner(3, 0.7f, 512, threads);
+            uint32_t version = 0;
+            std::string params = sizeParams(rows, cols) + (threads == 1 ? "_1hilo" : "_hilos");
+            runBench("KShortestPaths::find", params, [&] {
+                if (planner.find(walkable, ++version, mainPath).empty()) std::abort();
+            });
+        }
+    }
+}
+
+// Validación de una celda libre (el caso caro: copia del tablero y búsqueda del camino)
+static void benchTowerPosition() {
+    const int sizes[][2] = {{12, 16}, {24, 32}, {48, 64}};
+    for (const auto& size : sizes) {
+        int rows = size[0];
+        int cols = size[1];
+        GameBoard board(rows, cols);
+
+        std::vector<SDL_Point> freeCells;
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) {
+                if (board.getCellType(r, c) == 0) {
+                    freeCells.push_back({c, r});
+                }
+            }
+        }
+
+        size_t next = 0;
+        runBench("GameBoard::isValidTowerPosition", sizeParams(rows, cols), [&] {
+            const SDL_Point& cell = freeCells[next++ % freeCells.size()];
+            if (!board.isValidTowerPosition(cell.y, cell.x)) std::abort();
+        });
+    }
+}
+
+// Colocación de torres seguidas en celdas libres (se rehace el tablero al agotarlas)
+static void benchTowerPlacement() {
+    const int sizes[][2] = {{12, 16}, {48, 64}, {1000, 1000}};
+    for (const auto& size : sizes) {
+        int rows = size[0];
+        int cols = size[1];
+        GameBoard board(rows, cols);
+
+        std::vector<SDL_Point> freeCells;
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) {
+                if (board.getCellType(r, c) == 0) {
+                    freeCells.push_back({c, r});
+                }
+            }
+        }
+
+        size_t next = 0;
+        runBench("GameBoard::placeTower", sizeParams(rows, cols), [&] {
+            if (next == freeCells.size()) {
+                board = GameBoard(rows, cols);
+                next = 0;
+            }
+        }, [&] {
+            const SDL_Point& cell = freeCells[next++];
+            if (!board.placeTower(cell.y, cell.x)) std::abort();
+        });
+    }
+}
+
+// Copia del tablero entero (una instantánea, como las de Simulation)
+static void benchBoardCopy() {
+    const int sizes[][2] = {{12, 16}, {48, 64}, {1000, 1000}};
+    for (const auto& size : sizes) {
+        GameBoard board(size[0], size[1]);
+        runBench("GameBoard::copia", sizeParams(size[0], size[1]), [&] {
+            GameBoard copy = board;
+            if (copy.getRows() != size[0]) std::abort();
+        });
+    }
+}
+
+// Un tick de ataques con todas las torres listas para disparar y enemigos
+// repartidos por los caminos (con vida de sobra para que no mueran)
+static void benchTowerAttacks() {
+    const int towerCounts[] = {4, 16, 48};
+    const int enemyCounts[] = {20, 100, 500};
+    for (int towerCount : towerCounts) {
+        for (int enemyCount : enemyCounts) {
+            Simulation simulation(nullptr, 12, 16, 0, 42);
+            EnemyManager* enemyManager = simulation.getEnemyManager();
+            TowerManager* towerManager = simulation.getTowerManager();
+            enemyManager->setAutoWaves(false);
+
+            RandomStream rng(towerCount);
+            const TowerType types[] = {TowerType::ARCHER, TowerType::MAGE, TowerType::ARTILLERY};
+            int placed = 0;
+            for (int attempt = 0; placed < towerCount && attempt < 10000; attempt++) {
+                int row = rng.nextInt(0, 11);
+                int col = rng.nextInt(0, 15);
+                if (simulation.placeTower(types[placed % 3], row, col, 1)) {
+                    placed++;
+                }
+            }
+
+            // Un enemigo cada 24 ms de simulación: ~12 s entre el primero y el último
+            Genome genome;
+            genome.health = 2e9f;
+            genome.speed = 60.0f;
+            int spawnInterval = 12000 / enemyCount;
+            for (int i = 0; i < enemyCount; i++) {
+                genome.enemyType = i % ENEMY_TYPE_COUNT;
+                enemyManager->spawnEnemyFromGenome(genome);
+                enemyManager->update(spawnInterval);
+            }
+
+            std::string params = std::to_string(placed) + "t_" + std::to_string(enemyManager->getEnemyCount()) + "e";
+            const auto& towers = towerManager->getTowers();
+            runBench("EnemyManager::processTowerAttacks", params,
+                     [towerManager] { towerManager->update(10000); },
+                     [enemyManager, &towers] { enemyManager->processTowerAttacks(towers); });
+        }
+    }
+}
+
+// Una generación con fitness al azar
+static void benchEvolve() {
+    const int populationSizes[] = {20, 100, 500, 2000};
+    for (int populationSize : populationSizes) {
+        GeneticAlgorithm geneticAlgorithm(populationSize, 0.1f, 0.7f, 2, 7);
+        RandomStream rng(populationSize);
+        runBench("GeneticAlgorithm::evolve", std::to_string(populationSize),
+                 [&] {
+                     for (Genome& genome : geneticAlgorithm.getPopulationRef()) {
+                         genome.fitness = rng.nextFloat() * 100.0f;
+                     }
+                 },
+                 [&] { geneticAlgorithm.evolve(); });
+    }
+}
+
+// Movimiento de los enemigos en un tick (los que llegan al final vuelven a empezar)
+static void benchEnemyMovement() {
+    GameBoard board(12, 16);
+    PathRegistry paths;
+    std::vector<SDL_Point> gridPath = AStar::findPath(
+        [&board](int x, int y) { return board.isCellWalkable(x, y); },
+        board.getEntrancePoint(), board.getExitPoint(), board.getCols(), board.getRows());
+    std::vector<SDL_Point> pixelPath;
+    for (const SDL_Point& cell : gridPath) {
+        pixelPath.push_back({cell.x * 50 + 25, cell.y * 50 + 25});
+    }
+    int pathId = paths.acquire(std::vector<SDL_Point>(pixelPath), board.getWalkableVersion());
+
+    float totalLength = paths.getTrack(pathId).getTotalLength();
+
+    const int enemyCounts[] = {100, 1000, 10000};
+    for (int enemyCount : enemyCounts) {
+        EnemyStore enemies;
+        RandomStream rng(enemyCount);
+        for (int i = 0; i < enemyCount; i++) {
+            enemies.add(static_cast<EnemyType>(i % ENEMY_TYPE_COUNT), pathId,
+                        rng.nextFloat() * totalLength);
+        }
+        auto restartArrived = [&] {
+            for (size_t i = 0; i < enemies.size(); i++) {
+                if (enemies.reachedEnd[i]) {
+                    enemies.reachedEnd[i] = 0;
+                    enemies.setPath(i, pathId);
+                }
+            }
+        };
+
+        runBench("EnemyStore::updateMovement", std::to_string(enemyCount),
+                 restartArrived,
+                 [&] { enemies.updateMovement(16, paths); });
+
+        // Posiciones de todos los enemigos tras un tick (lo que pide la rejilla de ataques)
+        runBench("EnemyStore::updatePositions", std::to_string(enemyCount),
+                 [&] {
+                     restartArrived();
+                     enemies.updateMovement(16, paths);
+                 },
+                 [&] { enemies.updatePositions(paths); });
+    }
+}
+
+// Una oleada completa: crear los enemigos y eliminarlos todos, con un almacén
+// nuevo (con y sin reservar antes) o con uno reutilizado entre oleadas
+static void benchEnemySpawn() {
+    const int waveSizes[] = {25, 1000};
+    for (int waveSize : waveSizes) {
+        std::vector<uint8_t> marked(waveSize, 1);
+        auto wave = [waveSize, &marked](EnemyStore& enemies) {
+            for (int i = 0; i < waveSize; i++) {
+                enemies.add(static_cast<EnemyType>(i % ENEMY_TYPE_COUNT), 0);
+            }
+            enemies.removeMarked(marked);
+        };
+
+        runBench("EnemyStore::oleada", "nuevo_sin_reserva/" + std::to_string(waveSize), [&] {
+            EnemyStore enemies;
+            wave(enemies);
+        });
+        runBench("EnemyStore::oleada", "nuevo_con_reserva/" + std::to_string(waveSize), [&] {
+            EnemyStore enemies;
+            enemies.reserve(waveSize);
+            wave(enemies);
+        });
+
+        EnemyStore reused;
+        reused.reserve(waveSize);
+        runBench("EnemyStore::oleada", "reutilizado/" + std::to_string(waveSize), [&] { wave(reused); });
+    }
+}
+
+// Un tick de EnemyManager::update con n enemigos quietos (velocidad 0): mueve,
+// actualiza el registro de rendimiento de cada uno y revisa las bajas. Debe
+// crecer de forma lineal con n. Se compara con la búsqueda lineal del registro
+// por id que hacía update antes (un recorrido del registro por enemigo)
+static void benchEnemyTelemetry() {
+    const int enemyCounts[] = {100, 1000, 10000};
+    for (int enemyCount : enemyCounts) {
+        Simulation simulation(nullptr, 12, 16, 0, 42);
+        EnemyManager* enemyManager = simulation.getEnemyManager();
+        enemyManager->setAutoWaves(false);
+
+        Genome genome;
+        genome.health = 2e9f;
+        genome.speed = 0.0f;
+        for (int i = 0; i < enemyCount; i++) {
+            genome.enemyType = i % ENEMY_TYPE_COUNT;
+            enemyManager->spawnEnemyFromGenome(genome);
+        }
+        runBench("EnemyManager::update", std::to_string(enemyCount), [&] { enemyManager->update(16); });
+
+        struct Record { int id; float timeAlive; };
+        std::vector<Record> records(enemyCount);
+        std::vector<int> ids(enemyCount);
+        for (int i = 0; i < enemyCount; i++) {
+            records[i] = {i + 1, 0.0f};
+            ids[i] = i + 1;
+        }
+        runBench("EnemyManager::update", "busqueda_lineal/" + std::to_string(enemyCount), [&] {
+            for (int id : ids) {
+                for (Record& record : records) {
+                    if (record.id == id) {
+                        record.timeAlive += 16;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+}
+
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-ms") == 0 && i + 1 < argc) {
+            minMs = std::atof(argv[++i]);
+        }
+    }
+
+    // Los mensajes de la partida no forman parte de la medición
+    Logger::instance().setLevel(LogLevel::ERROR);
+
+    benchAStar();
+    benchFlowField();
+    benchFloodFill();
+    benchIncrementalPath();
+    benchAlternativePaths();
+    benchTowerPosition();
+    benchTowerPlacement();
+    benchBoardCopy();
+    benchTowerAttacks();
+    benchEvolve();
+    benchEnemyMovement();
+    benchEnemySpawn();
+    benchEnemyTelemetry();
+
+    Logger::instance().flush();
+    return 0;
+}
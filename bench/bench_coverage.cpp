@@ -0,0 +1,136 @@
+// Benchmark: selección de objetivos con intervalos de cobertura frente al
+// recorrido con distancia euclidiana (el método anterior de processTowerAttacks).
+// Uso: bench_coverage [torres] [enemigos] [iteraciones]
+#include "../src/PathCoverage.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+static const int GRID_SIZE = 50;
+static const int ROWS = 12;
+static const int COLS = 16;
+
+struct BenchEnemy {
+    float x, y;
+    int pathIndex;
+};
+
+// Camino en zigzag por el tablero (centros de celda, como los de A*)
+static std::vector<SDL_Point> buildPath() {
+    std::vector<SDL_Point> path;
+    for (int row = 1; row < ROWS - 1; row += 3) {
+        bool leftToRight = (row / 3) % 2 == 0;
+        for (int i = 0; i < COLS; i++) {
+            int col = leftToRight ? i : COLS - 1 - i;
+            path.push_back({col * GRID_SIZE + GRID_SIZE / 2, row * GRID_SIZE + GRID_SIZE / 2});
+        }
+        for (int r = row + 1; r < row + 3 && r < ROWS - 1; r++) {
+            int col = leftToRight ? COLS - 1 : 0;
+            path.push_back({col * GRID_SIZE + GRID_SIZE / 2, r * GRID_SIZE + GRID_SIZE / 2});
+        }
+    }
+    return path;
+}
+
+int main(int argc, char* argv[]) {
+    int towerCount = argc > 1 ? std::atoi(argv[1]) : 20;
+    int enemyCount = argc > 2 ? std::atoi(argv[2]) : 200;
+    int iterations = argc > 3 ? std::atoi(argv[3]) : 2000;
+
+    std::mt19937 rng(12345);
+    std::vector<SDL_Point> path = buildPath();
+
+    // Enemigos repartidos por los tramos del camino
+    std::vector<BenchEnemy> enemies;
+    std::uniform_int_distribution<int> indexDist(1, static_cast<int>(path.size()) - 1);
+    std::uniform_real_distribution<float> t(0.0f, 1.0f);
+    for (int i = 0; i < enemyCount; i++) {
+        int k = indexDist(rng);
+        float s = t(rng);
+        const SDL_Point& a = path[k - 1];
+        const SDL_Point& b = path[k];
+        enemies.push_back({a.x + (b.x - a.x) * s, a.y + (b.y - a.y) * s, k});
+    }
+
+    // Torres en celdas al azar con el alcance de los tres tipos
+    struct BenchTower { int x, y, range; PathCoverage coverage; };
+    std::vector<BenchTower> towers(towerCount);
+    std::uniform_int_distribution<int> rowDist(0, ROWS - 1), colDist(0, COLS - 1), rangeDist(0, 2);
+    const int ranges[3] = {150, 120, 100};
+    for (auto& tower : towers) {
+        tower.x = colDist(rng) * GRID_SIZE + GRID_SIZE / 2;
+        tower.y = rowDist(rng) * GRID_SIZE + GRID_SIZE / 2;
+        tower.range = ranges[rangeDist(rng)];
+    }
+
+    const float stepDistance = 1.0f;  // ~60 px/s a 16 ms por tick
+    bool mismatch = false;
+
+    std::printf("Torres: %d, enemigos: %d, puntos de camino: %zu, iteraciones: %d\n",
+                towerCount, enemyCount, path.size(), iterations);
+
+    // Modo 0: primer enemigo al alcance (como processTowerAttacks); modo 1: todos
+    for (int mode = 0; mode < 2; mode++) {
+        bool stopAtFirst = mode == 0;
+        long scanChecksum = 0;
+        long coverageChecksum = 0;
+
+        // Método anterior: distancia con raíz cuadrada a cada enemigo
+        auto scanStart = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) {
+            for (const auto& tower : towers) {
+                for (int i = 0; i < enemyCount; i++) {
+                    SDL_Point pos = {static_cast<int>(enemies[i].x), static_cast<int>(enemies[i].y)};
+                    float dx = pos.x - tower.x;
+                    float dy = pos.y - tower.y;
+                    if (std::sqrt(dx*dx + dy*dy) <= tower.range) {
+                        scanChecksum += i;
+                        if (stopAtFirst) break;
+                    }
+                }
+            }
+        }
+        auto scanEnd = std::chrono::steady_clock::now();
+
+        // Cobertura: una consulta a la tabla; solo los tramos parciales calculan distancia
+        auto coverageStart = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) {
+            for (auto& tower : towers) {
+                const std::vector<CoverageKind>& kinds =
+                    tower.coverage.getKinds(0, path, tower.x, tower.y, tower.range);
+                for (int i = 0; i < enemyCount; i++) {
+                    CoverageKind kind = PathCoverage::classify(kinds, enemies[i].pathIndex, stepDistance);
+                    bool inRange = kind == CoverageKind::INSIDE;
+                    if (kind == CoverageKind::PARTIAL) {
+                        int dx = static_cast<int>(enemies[i].x) - tower.x;
+                        int dy = static_cast<int>(enemies[i].y) - tower.y;
+                        inRange = dx*dx + dy*dy <= tower.range * tower.range;
+                    }
+                    if (inRange) {
+                        coverageChecksum += i;
+                        if (stopAtFirst) break;
+                    }
+                }
+            }
+        }
+        auto coverageEnd = std::chrono::steady_clock::now();
+
+        double ops = static_cast<double>(iterations) * towerCount;
+        double scanNs = std::chrono::duration<double, std::nano>(scanEnd - scanStart).count() / ops;
+        double coverageNs = std::chrono::duration<double, std::nano>(coverageEnd - coverageStart).count() / ops;
+
+        std::printf("[%s]\n", stopAtFirst ? "primer objetivo" : "todos al alcance");
+        std::printf("  recorrido con distancia : %10.1f ns/torre\n", scanNs);
+        std::printf("  intervalos de cobertura : %10.1f ns/torre (x%.2f)\n", coverageNs, scanNs / coverageNs);
+
+        if (scanChecksum != coverageChecksum) {
+            std::printf("  ERROR: los objetivos no coinciden (%ld != %ld)\n", scanChecksum, coverageChecksum);
+            mismatch = true;
+        }
+    }
+
+    return mismatch ? 1 : 0;
+}
@@ -2,13 +2,11 @@
 #define ASTAR_H
 
 #include <vector>
-#include <queue>
-#include <unordered_set>
-#include <unordered_map>
-#include <functional>
+#include <cstdint>
+#include <cstdlib>
 #include <SDL2/SDL.h>
 #include <algorithm>
-#include <iostream>
+#include "WalkableBitmap.h"
 
 // Add this line - defines equality comparison for SDL_Point
 inline bool operator==(const SDL_Point& a, const SDL_Point& b) {
@@ -22,13 +20,13 @@ private:
         SDL_Point position;  // Posición en la cuadrícula
         int gCost;           // Costo desde el inicio
         int hCost;           // Heurística (estimación hasta el destino)
-        
+
         // Obtener costo total (f = g + h)
         int getFCost() const { return gCost + hCost; }
-        
+
         // Constructor
         Node(SDL_Point pos, int g, int h) : position(pos), gCost(g), hCost(h) {}
-        
+
         // Operadores de comparación para la cola de prioridad
         bool operator<(const Node& other) const {
             // Ordenar primero por costo F, luego por H para desempatar
@@ -36,103 +34,172 @@ private:
                 return hCost > other.hCost;
             return getFCost() > other.getFCost();
         }
-        
+
         bool operator==(const Node& other) const {
             return position.x == other.position.x && position.y == other.position.y;
         }
     };
-    
-    // Hash function para SDL_Point (para usar en unordered_set/map)
-    struct PointHash {
-        std::size_t operator()(const SDL_Point& point) const {
-            return std::hash<int>()(point.x) ^ std::hash<int>()(point.y);
-        }
-    };
-    
-    struct PointEqual {
-        bool operator()(const SDL_Point& a, const SDL_Point& b) const {
-            return a.x == b.x && a.y == b.y;
+
+    // Memoria de trabajo de una búsqueda, indexada por celda (y * width + x).
+    // Se reutiliza entre llamadas del mismo hilo: en lugar de limpiar los arrays,
+    // cada búsqueda usa un número de generación nuevo y una celda solo cuenta
+    // como visitada o cerrada si su marca coincide con la generación actual.
+    struct SearchContext {
+        std::vector<uint32_t> visited;  // Generación en la que se asignó gCost/parent
+        std::vector<uint32_t> closed;   // Generación en la que se cerró la celda
+        std::vector<int> gCost;
+        std::vector<int> parent;        // Celda anterior en el camino (-1 = ninguna)
+        std::vector<Node> openSet;      // Montículo (mismo orden que std::priority_queue)
+        uint32_t generation = 0;
+
+        void prepare(size_t cellCount) {
+            if (visited.size() < cellCount) {
+                visited.resize(cellCount, 0);
+                closed.resize(cellCount, 0);
+                gCost.resize(cellCount, 0);
+                parent.resize(cellCount, -1);
+            }
+
+            // Al dar la vuelta el contador, las marcas antiguas podrían coincidir
+            if (++generation == 0) {
+                std::fill(visited.begin(), visited.end(), 0);
+                std::fill(closed.begin(), closed.end(), 0);
+                generation = 1;
+            }
+            openSet.clear();
         }
     };
 
+    // Un contexto por hilo (los evaluadores de fitness buscan caminos en paralelo)
+    static SearchContext& getContext() {
+        thread_local SearchContext context;
+        return context;
+    }
+
 public:
-    // Rest of your AStar implementation...
-    // [same as before]
-    
-    // Función principal para encontrar camino (devuelve vector de puntos)
+    // Función principal para encontrar camino (devuelve vector de puntos).
+    // isWalkable es cualquier invocable bool(int x, int y): al ser un parámetro
+    // de plantilla la comprobación se inserta en el bucle, sin llamadas indirectas
+    template <typename Walkable>
     static std::vector<SDL_Point> findPath(
-        const std::function<bool(int, int)>& isWalkable,
+        const Walkable& isWalkable,
         SDL_Point start, SDL_Point end, int width, int height) {
-        
-        // Cola de prioridad para nodos por explorar (ordenados por menor costo F)
-        std::priority_queue<Node> openSet;
-        
-        // Conjunto de nodos ya procesados
-        std::unordered_set<SDL_Point, PointHash, PointEqual> closedSet;
-        
-        // Mapa para reconstruir el camino
-        std::unordered_map<SDL_Point, SDL_Point, PointHash, PointEqual> cameFrom;
-        
-        // Mapa para almacenar costos G
-        std::unordered_map<SDL_Point, int, PointHash, PointEqual> gScore;
-        
+
+        std::vector<SDL_Point> path;
+        findPath(isWalkable, start, end, width, height, path);
+        return path;
+    }
+
+    // Versión rápida con el mapa de bits de celdas caminables del tablero
+    // (GameBoard::getWalkableMap()), que ya conoce sus dimensiones
+    static std::vector<SDL_Point> findPath(const WalkableBitmap& walkableMap, SDL_Point start, SDL_Point end) {
+        std::vector<SDL_Point> path;
+        findPath(walkableMap, start, end, walkableMap.getCols(), walkableMap.getRows(), path);
+        return path;
+    }
+
+    static bool findPath(const WalkableBitmap& walkableMap, SDL_Point start, SDL_Point end,
+                         std::vector<SDL_Point>& path) {
+        return findPath(walkableMap, start, end, walkableMap.getCols(), walkableMap.getRows(), path);
+    }
+
+    // Igual, pero escribe el camino en 'path' (vacío si no hay) para reutilizar su memoria;
+    // devuelve si se encontró camino
+    template <typename Walkable>
+    static bool findPath(
+        const Walkable& isWalkable,
+        SDL_Point start, SDL_Point end, int width, int height,
+        std::vector<SDL_Point>& path) {
+
+        auto manhattan = [end](int x, int y) { return calculateHCost({x, y}, end); };
+        return findPath(isWalkable, manhattan, start, end, width, height, path);
+    }
+
+    // Con otra heurística: cualquier invocable int(int x, int y) que no sobrestime
+    // los pasos hasta 'end' (por ejemplo las distancias exactas de un FlowField
+    // calculado sin obstáculos añadidos, que guían mucho mejor que Manhattan)
+    template <typename Walkable, typename Heuristic>
+    static bool findPath(
+        const Walkable& isWalkable, const Heuristic& heuristic,
+        SDL_Point start, SDL_Point end, int width, int height,
+        std::vector<SDL_Point>& path) {
+
+        path.clear();
+        if (width <= 0 || height <= 0) {
+            return false;
+        }
+
+        SearchContext& context = getContext();
+        context.prepare(static_cast<size_t>(width) * height);
+        const uint32_t generation = context.generation;
+        std::vector<Node>& openSet = context.openSet;
+
         // Inicializar con el nodo de inicio
-        openSet.push(Node(start, 0, calculateHCost(start, end)));
-        gScore[start] = 0;
-        
+        int startIndex = start.y * width + start.x;
+        openSet.push_back(Node(start, 0, heuristic(start.x, start.y)));
+        context.visited[startIndex] = generation;
+        context.gCost[startIndex] = 0;
+        context.parent[startIndex] = -1;
+
         // Direcciones posibles (4 direcciones: arriba, derecha, abajo, izquierda)
         const int dx[] = {0, 1, 0, -1};
         const int dy[] = {-1, 0, 1, 0};
-        
+
         // Bucle principal de A*
         while (!openSet.empty()) {
             // Obtener nodo con menor costo F
-            Node current = openSet.top();
-            openSet.pop();
-            
+            std::pop_heap(openSet.begin(), openSet.end());
+            Node current = openSet.back();
+            openSet.pop_back();
+            int currentIndex = current.position.y * width + current.position.x;
+
             // Si llegamos al destino
             if (current.position.x == end.x && current.position.y == end.y) {
-                return reconstructPath(cameFrom, current.position);
+                reconstructPath(context, currentIndex, width, path);
+                return true;
             }
-            
+
             // Marcar como procesado
-            if (closedSet.find(current.position) != closedSet.end()) {
+            if (context.closed[currentIndex] == generation) {
                 continue;  // Si ya lo procesamos, saltamos
             }
-            closedSet.insert(current.position);
-            
+            context.closed[currentIndex] = generation;
+
             // Explorar vecinos
             for (int i = 0; i < 4; i++) {
                 int newX = current.position.x + dx[i];
                 int newY = current.position.y + dy[i];
-                
-                SDL_Point neighbor = {newX, newY};
-                
+
                 // Verificar límites y si es caminable
-                if (newX < 0 || newX >= width || newY < 0 || newY >= height || 
-                    !isWalkable(newX, newY) || 
-                    closedSet.find(neighbor) != closedSet.end()) {
+                if (newX < 0 || newX >= width || newY < 0 || newY >= height) {
+                    continue;
+                }
+                int neighborIndex = newY * width + newX;
+                if (!isWalkable(newX, newY) || context.closed[neighborIndex] == generation) {
                     continue;
                 }
-                
+
                 // Calcular nuevo costo G (distancia desde inicio)
-                int tentativeGScore = gScore[current.position] + 1;
-                
+                int tentativeGScore = context.gCost[currentIndex] + 1;
+
                 // Si es un nodo nuevo o encontramos un camino mejor
-                if (gScore.find(neighbor) == gScore.end() || tentativeGScore < gScore[neighbor]) {
+                if (context.visited[neighborIndex] != generation || tentativeGScore < context.gCost[neighborIndex]) {
                     // Actualizar camino y costo
-                    cameFrom[neighbor] = current.position;
-                    gScore[neighbor] = tentativeGScore;
-                    
+                    context.visited[neighborIndex] = generation;
+                    context.parent[neighborIndex] = currentIndex;
+                    context.gCost[neighborIndex] = tentativeGScore;
+
                     // Añadir a la cola con costo actualizado
-                    int hCost = calculateHCost(neighbor, end);
-                    openSet.push(Node(neighbor, tentativeGScore, hCost));
+                    SDL_Point neighbor = {newX, newY};
+                    int hCost = heuristic(newX, newY);
+                    openSet.push_back(Node(neighbor, tentativeGScore, hCost));
+                    std::push_heap(openSet.begin(), openSet.end());
                 }
             }
         }
-        
+
         // No se encontró camino
-        return std::vector<SDL_Point>();
+        return false;
     }
 
 private:
@@ -140,28 +207,23 @@ private:
     static int calculateHCost(SDL_Point a, SDL_Point b) {
         return std::abs(a.x - b.x) + std::abs(a.y - b.y);
     }
-    
+
     // Reconstruir el camino desde el destino hasta el inicio
-    static std::vector<SDL_Point> reconstructPath(
-        const std::unordered_map<SDL_Point, SDL_Point, PointHash, PointEqual>& cameFrom,
-        SDL_Point current) {
-        
-        std::vector<SDL_Point> path;
-        
-        // Añadir destino
-        path.push_back(current);
-        
-        // Recorrer el mapa 'cameFrom' hasta llegar al inicio
-        while (cameFrom.find(current) != cameFrom.end()) {
-            current = cameFrom.at(current);
-            path.push_back(current);
+    static void reconstructPath(const SearchContext& context, int current, int width,
+                                std::vector<SDL_Point>& path) {
+        // Contar los pasos para reservar el camino de una vez
+        size_t length = 0;
+        for (int cell = current; cell != -1; cell = context.parent[cell]) {
+            length++;
+        }
+
+        // Recorrer los padres hasta llegar al inicio, rellenando desde el final
+        path.resize(length);
+        for (size_t i = length; i-- > 0; ) {
+            path[i] = {current % width, current / width};
+            current = context.parent[current];
         }
-        
-        // Invertir para obtener camino desde inicio a fin
-        std::reverse(path.begin(), path.end());
-        
-        return path;
     }
 };
 
-#endif // ASTAR_H
\ No newline at end of file
+#endif // ASTAR_H
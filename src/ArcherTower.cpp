@@ -1,5 +1,5 @@
 #include "ArcherTower.h"
-#include <iostream>
+#include "Logger.h"
 
 ArcherTower::ArcherTower(int r, int c, SDL_Texture* tex) : Tower(r, c, BASE_COST, tex) {
     // Inicializa atributos específicos
@@ -22,14 +22,14 @@ void ArcherTower::attack() {
     }
     
     // Lógica de ataque normal
-    std::cout << "¡Arquero ataca! Daño: " << damage << std::endl;
+    LOG_DEBUG("¡Arquero ataca! Daño: %d", damage);
 }
 
 
 void ArcherTower::performSpecialAttack() {
     // Lógica de ataque especial: lluvia de flechas (múltiples flechas simultáneas)
-    std::cout << "¡¡ATAQUE ESPECIAL!! Arquero lanza " << SPECIAL_ARROWS 
-              << " flechas simultáneas! Daño total: " << (damage * SPECIAL_ARROWS) << std::endl;
+    LOG_DEBUG("¡¡ATAQUE ESPECIAL!! Arquero lanza %d flechas simultáneas! Daño total: %d",
+              SPECIAL_ARROWS, damage * SPECIAL_ARROWS);
     
     // En una implementación completa, aquí buscaríamos múltiples enemigos en rango
     // y les aplicaríamos daño, o atacaríamos al mismo enemigo múltiples veces
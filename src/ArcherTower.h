@@ -18,7 +18,7 @@ public:
     
     // Implementación de métodos virtuales
     void attack() override;
-    std::string getType() const override { return "Arquero"; }
+    TowerType getKind() const override { return TowerType::ARCHER; }
 
     void performSpecialAttack() override;
 
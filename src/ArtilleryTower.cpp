@@ -1,5 +1,5 @@
 #include "ArtilleryTower.h"
-#include <iostream>
+#include "Logger.h"
 
 ArtilleryTower::ArtilleryTower(int r, int c, SDL_Texture* tex) : Tower(r, c, BASE_COST, tex) {
     // Inicializa atributos específicos
@@ -22,14 +22,13 @@ void ArtilleryTower::attack() {
     }
     
     // Lógica de ataque normal
-    std::cout << "¡Artillero dispara cañón! Daño: " << damage << std::endl;
+    LOG_DEBUG("¡Artillero dispara cañón! Daño: %d", damage);
 }
 
 void ArtilleryTower::performSpecialAttack() {
     // Lógica de ataque especial: proyectil aturdidor
-    std::cout << "¡¡ATAQUE ESPECIAL!! Artillero lanza proyectil aturdidor! "
-              << "Daño: " << (damage * 1.2) << " y aturde por " 
-              << (STUN_DURATION/1000) << " segundos" << std::endl;
+    LOG_DEBUG("¡¡ATAQUE ESPECIAL!! Artillero lanza proyectil aturdidor! Daño: %g y aturde por %g segundos",
+              damage * 1.2, STUN_DURATION / 1000);
     
     // En una implementación completa, aquí buscaríamos un enemigo,
     // le aplicaríamos daño y le añadiríamos un efecto de aturdimiento
@@ -18,7 +18,7 @@ public:
     
     // Implementación de métodos virtuales
     void attack() override;
-    std::string getType() const override { return "Artillero"; }
+    TowerType getKind() const override { return TowerType::ARTILLERY; }
 
     void performSpecialAttack() override;
 
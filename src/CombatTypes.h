@@ -0,0 +1,68 @@
+#ifndef COMBAT_TYPES_H
+#define COMBAT_TYPES_H
+
+#include <cstdint>
+
+// Tipos de torre (NONE: ninguna seleccionada)
+enum class TowerType {
+    NONE,
+    ARCHER,
+    MAGE,
+    ARTILLERY
+};
+
+const int TOWER_TYPE_COUNT = 4;
+
+// Tipos de daño: cada torre hace un tipo y cada enemigo resiste cada tipo
+enum class DamageType : uint8_t {
+    ARROW,
+    MAGIC,
+    ARTILLERY
+};
+
+const int DAMAGE_TYPE_COUNT = 3;
+
+// Máscara de bits de un tipo de daño (para inmunidades)
+constexpr uint8_t damageBit(DamageType type) {
+    return static_cast<uint8_t>(1u << static_cast<int>(type));
+}
+
+// Datos fijos de cada tipo de torre para el combate
+struct TowerKind {
+    const char* name;          // Nombre para mostrar
+    DamageType damageType;     // Tipo de daño que hace
+    int specialMultiplier;     // Multiplicador de daño del ataque especial
+};
+
+// Tabla indexada por TowerType
+constexpr TowerKind TOWER_KINDS[TOWER_TYPE_COUNT] = {
+    {"Ninguna",   DamageType::ARROW,     1},
+    {"Arquero",   DamageType::ARROW,     3},  // Lluvia de flechas
+    {"Mago",      DamageType::MAGIC,     2},  // Explosión arcana
+    {"Artillero", DamageType::ARTILLERY, 2}   // Proyectil aturdidor
+};
+
+constexpr const TowerKind& getTowerKind(TowerType type) {
+    return TOWER_KINDS[static_cast<int>(type)];
+}
+
+// Referencia estable a un enemigo (la guardan los registros de rendimiento):
+// sigue siendo válida aunque el enemigo cambie de posición en los arrays de
+// EnemyStore, y deja de serlo (se detecta) cuando se elimina
+struct EnemyHandle {
+    uint32_t slot;
+    uint32_t generation;
+};
+
+// Handle que no corresponde a ningún enemigo
+constexpr EnemyHandle NO_ENEMY = {UINT32_MAX, 0};
+
+constexpr bool operator==(EnemyHandle a, EnemyHandle b) {
+    return a.slot == b.slot && a.generation == b.generation;
+}
+
+constexpr bool operator!=(EnemyHandle a, EnemyHandle b) {
+    return !(a == b);
+}
+
+#endif // COMBAT_TYPES_H
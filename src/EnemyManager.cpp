@@ -1,38 +1,30 @@
 #include "EnemyManager.h"
-#include "OgreEnemy.h"
-#include "DarkElfEnemy.h"
-#include "HarpyEnemy.h"
 #include "Tower.h"  
-#include "MercenaryEnemy.h"
 #include "Game.h"  // Añadir este include
-#include <iostream>
+#include "Logger.h"
+#include "Profiler.h"
 #include <algorithm>  // Para std::sort
-#include <map>
 
 
 
-EnemyManager::EnemyManager(GameBoard* board, ResourceSystem* res, SDL_Renderer* renderer)
-    : ogreTexture(nullptr), darkElfTexture(nullptr), harpyTexture(nullptr), mercenaryTexture(nullptr),
-      resources(res), waveTimer(0), waveInterval(30000), enemiesPerWave(5), currentWave(0) {
-    
-    // Configurar punto de entrada desde el tablero
-    entrancePoint = {board->getEntrancePoint().x * 50 + 25, board->getEntrancePoint().y * 50 + 25};
+EnemyManager::EnemyManager(GameBoard* board, ResourceSystem* res, SDL_Renderer* renderer, uint64_t seed)
+    : geneticAlgorithm(20, 0.1f, 0.7f, 2, seed),
+      enemyGrid(board->getRows(), board->getCols(), 50), alternativePlanner(3, 0.7f, 512, 1), pathsBoardVersion(0),
+      ogreTexture(nullptr), darkElfTexture(nullptr), harpyTexture(nullptr), mercenaryTexture(nullptr),
+      resources(res), waveTimer(0), waveInterval(30000), enemiesPerWave(5), currentWave(0),
+      autoWaves(true), rng(RandomStream::forSubsystem(seed, RngStreamId::ENEMY_MANAGER)) {
     
     // Generar caminos posibles
     generatePaths(board);
     
-    // Inicializar generador de números aleatorios
-    std::random_device rd;
-    rng = std::mt19937(rd());
-    enemyTypeDist = std::uniform_int_distribution<int>(0, 3);
-    pathDist = std::uniform_int_distribution<int>(0, paths.size() - 1);
-    
-    // Cargar texturas
-    loadTextures(renderer);
+    // Cargar texturas (sin renderer, modo headless, se usan los colores de respaldo)
+    if (renderer) {
+        loadTextures(renderer);
+    }
     
-    // Inicializar el algoritmo genético y el contador de ID
-    geneticAlgorithm = GeneticAlgorithm(20, 0.1f, 0.7f, 2);
-    nextEnemyId = 1;
+    // Reservar el almacén de enemigos desde el principio
+    enemies.reserve(INITIAL_ENEMY_CAPACITY);
+    removedEnemies.reserve(INITIAL_ENEMY_CAPACITY);
 }
 
 EnemyManager::~EnemyManager() {
@@ -47,7 +39,7 @@ bool EnemyManager::loadTextures(SDL_Renderer* renderer) {
     // Cargar las imágenes para cada tipo de enemigo
     SDL_Surface* surface = IMG_Load("images/ogro.png");
     if (!surface) {
-        std::cerr << "No se pudo cargar la imagen ogro.png: " << IMG_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la imagen ogro.png: %s", IMG_GetError());
         return false;
     }
     ogreTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -55,7 +47,7 @@ bool EnemyManager::loadTextures(SDL_Renderer* renderer) {
     
     surface = IMG_Load("images/elfo.png");
     if (!surface) {
-        std::cerr << "No se pudo cargar la imagen elfo.png: " << IMG_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la imagen elfo.png: %s", IMG_GetError());
         return false;
     }
     darkElfTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -63,7 +55,7 @@ bool EnemyManager::loadTextures(SDL_Renderer* renderer) {
     
     surface = IMG_Load("images/harpia.png");
     if (!surface) {
-        std::cerr << "No se pudo cargar la imagen harpia.png: " << IMG_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la imagen harpia.png: %s", IMG_GetError());
         return false;
     }
     harpyTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -71,7 +63,7 @@ bool EnemyManager::loadTextures(SDL_Renderer* renderer) {
     
     surface = IMG_Load("images/mercenario.png");
     if (!surface) {
-        std::cerr << "No se pudo cargar la imagen mercenario.png: " << IMG_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la imagen mercenario.png: %s", IMG_GetError());
         return false;
     }
     mercenaryTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -81,8 +73,31 @@ bool EnemyManager::loadTextures(SDL_Renderer* renderer) {
 }
 
 void EnemyManager::generatePaths(GameBoard* board) {
+    // Si las celdas caminables no cambiaron (p.ej. una torre fuera del camino),
+    // los caminos actuales siguen valiendo y no hay nada que recalcular
+    if (!currentPaths.empty() && board->getWalkableVersion() == pathsBoardVersion) {
+        return;
+    }
 
     generatePathsWithAStar(board);
+    pathsBoardVersion = board->getWalkableVersion();
+
+    // Registrar los nuevos caminos (sin copiarlos; uno igual a uno anterior se
+    // comparte) y soltar los anteriores: los enemigos que aún los siguen
+    // conservan su referencia
+    std::vector<int> previousPaths;
+    previousPaths.swap(currentPaths);
+    for (std::vector<SDL_Point>& path : paths) {
+        currentPaths.push_back(pathRegistry.acquire(std::move(path), pathsBoardVersion));
+    }
+    paths.clear();
+    for (int id : previousPaths) {
+        pathRegistry.release(id);
+    }
+    
+    // Un solo cálculo del campo de distancias sirve para desviar a todos los enemigos
+    flowField.compute(board->getWalkableMap(), board->getExitPoint());
+    rerouteBlockedEnemies(board);
 
     // Limpiar caminos anteriores
     // paths.clear();
@@ -151,6 +166,79 @@ void EnemyManager::generatePaths(GameBoard* board) {
 
 
 
+void EnemyManager::rerouteBlockedEnemies(GameBoard* board) {
+    if (enemies.empty()) {
+        return;
+    }
+    
+    const WalkableBitmap& walkableMap = board->getWalkableMap();
+    int rows = board->getRows();
+    int cols = board->getCols();
+    int gridSize = 50;
+    enemies.updatePositions(pathRegistry);
+    
+    // Cada camino se revisa una vez (no una por enemigo): -2 = sin revisar
+    pathBlockedAt.assign(pathRegistry.getIdCount(), -2);
+    rerouteByCell.assign(rows * cols, -1);
+    std::vector<int> reroutes;
+    int rerouted = 0;
+    
+    for (size_t i = 0; i < enemies.size(); i++) {
+        int pathId = enemies.pathId[i];
+        if (pathBlockedAt[pathId] == -2) {
+            pathBlockedAt[pathId] = -1;
+            const std::vector<SDL_Point>& path = pathRegistry.get(pathId);
+            for (int k = static_cast<int>(path.size()) - 1; k >= 0; k--) {
+                int col = path[k].x / gridSize;
+                int row = path[k].y / gridSize;
+                if (row >= 0 && row < rows && col >= 0 && col < cols && !walkableMap.isWalkable(col, row)) {
+                    pathBlockedAt[pathId] = k;
+                    break;
+                }
+            }
+        }
+        
+        // Solo importan las celdas que el enemigo aún no ha recorrido
+        if (pathBlockedAt[pathId] < enemies.pathIndex[i]) {
+            continue;
+        }
+        
+        // Los enemigos de la misma celda comparten el camino nuevo
+        int col = std::min(std::max(static_cast<int>(enemies.x[i]) / gridSize, 0), cols - 1);
+        int row = std::min(std::max(static_cast<int>(enemies.y[i]) / gridSize, 0), rows - 1);
+        int cell = row * cols + col;
+        if (rerouteByCell[cell] == -1) {
+            rerouteByCell[cell] = -2;  // Sin camino: el enemigo sigue con el suyo
+            
+            std::vector<SDL_Point> route;
+            if (flowField.buildRoute({col, row}, route)) {
+                for (SDL_Point& point : route) {
+                    point = {point.x * gridSize + gridSize/2, point.y * gridSize + gridSize/2};
+                }
+                rerouteByCell[cell] = pathRegistry.acquire(std::move(route), board->getWalkableVersion());
+                reroutes.push_back(rerouteByCell[cell]);
+            }
+        }
+        
+        if (rerouteByCell[cell] >= 0) {
+            pathRegistry.retain(rerouteByCell[cell]);
+            pathRegistry.release(pathId);
+            // Empieza en el centro de su celda actual (el primer punto del camino nuevo)
+            enemies.setPath(i, rerouteByCell[cell]);
+            rerouted++;
+        }
+    }
+    
+    // Cada enemigo desviado tiene ya su referencia al camino nuevo
+    for (int id : reroutes) {
+        pathRegistry.release(id);
+    }
+    
+    if (rerouted > 0) {
+        LOG_INFO("%d enemigos desviados por el campo de distancias", rerouted);
+    }
+}
+
 void EnemyManager::generatePathsWithAStar(GameBoard* board) {
     // Limpiar caminos anteriores
     paths.clear();
@@ -159,24 +247,20 @@ void EnemyManager::generatePathsWithAStar(GameBoard* board) {
     SDL_Point entrance = board->getEntrancePoint();
     SDL_Point exit = board->getExitPoint();
     
-    std::cout << "Generando caminos con A* desde (" << entrance.x << "," << entrance.y 
-              << ") hasta (" << exit.x << "," << exit.y << ")" << std::endl;
+    LOG_DEBUG("Generando caminos con A* desde (%d,%d) hasta (%d,%d)", entrance.x, entrance.y, exit.x, exit.y);
     
-    // Función lambda para verificar si una celda es caminable
-    auto isWalkable = [board](int x, int y) {
-        return board->isCellWalkable(x, y);
-    };
-    
-    // Encontrar el camino principal usando A*
-    std::vector<SDL_Point> mainGridPath = AStar::findPath(
-        isWalkable, entrance, exit, board->getCols(), board->getRows());
+    // Encontrar el camino principal (A* incremental: tras un cambio del tablero
+    // solo se repara la parte de la búsqueda afectada)
+    std::vector<SDL_Point> mainGridPath;
+    mainPlanner.findPath(board->getWalkableMap(), board->getWalkableVersion(), entrance, exit, mainGridPath);
+    LOG_DEBUG("A* incremental: %d celdas expandidas", mainPlanner.getLastExpansions());
     
     if (mainGridPath.empty()) {
-        std::cerr << "¡Error! A* no pudo encontrar un camino." << std::endl;
+        LOG_ERROR("¡Error! A* no pudo encontrar un camino.");
         return;
     }
     
-    std::cout << "A* encontró un camino con " << mainGridPath.size() << " puntos." << std::endl;
+    LOG_DEBUG("A* encontró un camino con %zu puntos.", mainGridPath.size());
     
     // Convertir las coordenadas de grid a coordenadas de píxeles (centro de cada celda)
     int gridSize = 50;
@@ -189,8 +273,8 @@ void EnemyManager::generatePathsWithAStar(GameBoard* board) {
         };
         mainPixelPath.push_back(pixelPos);
         
-        std::cout << "Punto de camino: coordenadas de grid (" << gridCell.x << "," << gridCell.y 
-                  << ") -> píxeles (" << pixelPos.x << "," << pixelPos.y << ")" << std::endl;
+        LOG_DEBUG("Punto de camino: coordenadas de grid (%d,%d) -> píxeles (%d,%d)",
+                  gridCell.x, gridCell.y, pixelPos.x, pixelPos.y);
     }
     
     // Agregar este camino a la lista
@@ -198,325 +282,324 @@ void EnemyManager::generatePathsWithAStar(GameBoard* board) {
     
     // Generar caminos alternativos (desviaciones)
     // Intentamos generar al menos 2 caminos alternativos
-    generateAlternativePaths(board, entrance, exit);
+    generateAlternativePaths(board, mainGridPath);
     
-    std::cout << "Total de caminos generados: " << paths.size() << std::endl;
+    LOG_DEBUG("Total de caminos generados: %zu", paths.size());
 }
 
-void EnemyManager::generateAlternativePaths(GameBoard* board, SDL_Point entrance, SDL_Point exit) {
+void EnemyManager::generateAlternativePaths(GameBoard* board, const std::vector<SDL_Point>& mainGridPath) {
     int gridSize = 50;
     
-    // Función para comprobar si una celda es caminable
-    auto isWalkable = [board](int x, int y) {
-        return board->isCellWalkable(x, y);
-    };
-    
-    // Intentar generar caminos alternativos añadiendo "obstáculos temporales"
-    // en diferentes puntos del camino principal
-    std::vector<SDL_Point> mainGridPath = AStar::findPath(
-        isWalkable, entrance, exit, board->getCols(), board->getRows());
-    
-    if (mainGridPath.size() < 4) {
-        // Camino demasiado corto para generar alternativas
-        return;
-    }
-    
-    // Intentamos bloquear temporalmente algunos puntos del camino principal
-    // para forzar caminos alternativos
-    for (size_t i = 1; i < mainGridPath.size() - 1; i += 2) {
-        SDL_Point blockedPoint = mainGridPath[i];
-        
-        // Crear una copia de la función isWalkable que evite el punto bloqueado
-        auto alternativeIsWalkable = [board, blockedPoint](int x, int y) {
-            if (x == blockedPoint.x && y == blockedPoint.y) {
-                return false;  // Este punto está "bloqueado" temporalmente
-            }
-            return board->isCellWalkable(x, y);
-        };
-        
-        // Intentar encontrar un camino alternativo
-        std::vector<SDL_Point> altGridPath = AStar::findPath(
-            alternativeIsWalkable, entrance, exit, board->getCols(), board->getRows());
-        
-        // Si encontramos un camino alternativo y es diferente del principal
-        if (!altGridPath.empty() && altGridPath != mainGridPath) {
-            // Convertir a coordenadas de píxeles
-            std::vector<SDL_Point> altPixelPath;
-            for (const SDL_Point& gridCell : altGridPath) {
-                SDL_Point pixelPos = {
-                    gridCell.x * gridSize + gridSize/2,
-                    gridCell.y * gridSize + gridSize/2
-                };
-                altPixelPath.push_back(pixelPos);
-            }
-            
-            // Añadir a la lista de caminos si es lo suficientemente diferente
-            if (isPathSufficientlyDifferent(altPixelPath)) {
-                paths.push_back(altPixelPath);
-                std::cout << "Camino alternativo generado con " << altPixelPath.size() << " puntos." << std::endl;
-            }
-            
-            // Si ya tenemos suficientes caminos, terminamos
-            if (paths.size() >= 3) {
-                break;
-            }
-        }
-    }
-}
-
-bool EnemyManager::isPathSufficientlyDifferent(const std::vector<SDL_Point>& newPath) {
-    // Verifica si un camino es significativamente diferente de los existentes
-    if (paths.empty()) {
-        return true;
-    }
-    
-    for (const auto& existingPath : paths) {
-        // Contar cuántos puntos son diferentes
-        int differentPoints = 0;
-        size_t minLength = std::min(existingPath.size(), newPath.size());
-        
-        for (size_t i = 0; i < minLength; i++) {
-            int dx = existingPath[i].x - newPath[i].x;
-            int dy = existingPath[i].y - newPath[i].y;
-            if (dx*dx + dy*dy > 100) {  // Si están a más de 10 píxeles de distancia
-                differentPoints++;
-            }
+    // Caminos diversos con Yen a partir del principal (el primero del resultado,
+    // que ya está en la lista); se guardan por versión del tablero
+    const std::vector<std::vector<SDL_Point>>& gridPaths =
+        alternativePlanner.find(board->getWalkableMap(), board->getWalkableVersion(), mainGridPath);
+    LOG_DEBUG("Caminos alternativos: %d búsquedas de desvío", alternativePlanner.getLastSpurSearches());
+    
+    for (size_t k = 1; k < gridPaths.size(); k++) {
+        // Convertir a coordenadas de píxeles
+        std::vector<SDL_Point> altPixelPath;
+        altPixelPath.reserve(gridPaths[k].size());
+        for (const SDL_Point& gridCell : gridPaths[k]) {
+            SDL_Point pixelPos = {
+                gridCell.x * gridSize + gridSize/2,
+                gridCell.y * gridSize + gridSize/2
+            };
+            altPixelPath.push_back(pixelPos);
         }
         
-        // Si menos del 30% de los puntos son diferentes, consideramos que es muy similar
-        if (differentPoints < minLength * 0.3) {
-            return false;
-        }
+        paths.push_back(altPixelPath);
+        LOG_DEBUG("Camino alternativo generado con %zu puntos.", altPixelPath.size());
     }
-    
-    return true;
 }
 
+size_t EnemyManager::createEnemy(EnemyType type, int pathId, float startDistance) {
+    // Crear un enemigo del tipo especificado con sus atributos base (el enemigo
+    // tiene una referencia a su camino mientras exista)
+    pathRegistry.retain(pathId);
+    return enemies.add(type, pathId, startDistance);
+}
 
-
-
-
-std::unique_ptr<Enemy> EnemyManager::createEnemy(EnemyType type, const std::vector<SDL_Point>& path) {
-    // Crear un enemigo del tipo especificado
+SDL_Texture* EnemyManager::getTexture(EnemyType type) const {
     switch (type) {
         case EnemyType::OGRE:
-            return std::make_unique<OgreEnemy>(entrancePoint.x, entrancePoint.y, path, ogreTexture);
+            return ogreTexture;
         case EnemyType::DARK_ELF:
-            return std::make_unique<DarkElfEnemy>(entrancePoint.x, entrancePoint.y, path, darkElfTexture);
+            return darkElfTexture;
         case EnemyType::HARPY:
-            return std::make_unique<HarpyEnemy>(entrancePoint.x, entrancePoint.y, path, harpyTexture);
+            return harpyTexture;
         case EnemyType::MERCENARY:
-            return std::make_unique<MercenaryEnemy>(entrancePoint.x, entrancePoint.y, path, mercenaryTexture);
+            return mercenaryTexture;
         default:
-            return std::make_unique<OgreEnemy>(entrancePoint.x, entrancePoint.y, path, ogreTexture);
+            return ogreTexture;
     }
 }
 
 void EnemyManager::spawnWave() {
     currentWave++;
-    std::cout << "¡Nueva oleada! Oleada #" << currentWave << std::endl;
+    LOG_INFO("¡Nueva oleada! Oleada #%d", currentWave);
     
     // Actualizar la dificultad con cada oleada
     enemiesPerWave = 5 + currentWave;
     
-    // Si no es la primera oleada, evolucionar la población
+    // Si no es la primera oleada, evolucionar la población con el fitness de la anterior
     if (currentWave > 1) {
-        // CORRECCIÓN: Crear un mapa para transferir los datos de fitness a la población real
-        std::map<int, float> fitnessMap;  // Mapa de tipo de enemigo -> fitness
-        std::map<int, int> countMap;      // Contador para promediar
-        
-        // Procesar los datos de rendimiento
-        for (auto& data : enemyPerformanceData) {
-            // Calcular fitness
-            float fitness = data.progressMade * 10.0f + (data.damageDealt / 100.0f) + (data.timeAlive / 1000.0f);
-            
-            std::cout << "DEBUG - UpdateFitness con valores: progreso=" << data.progressMade 
-                     << ", daño=" << data.damageDealt 
-                     << ", tiempo=" << data.timeAlive << std::endl;
-            std::cout << "Fitness actualizado: " << fitness << std::endl;
-            
-            // Acumular fitness por tipo de enemigo para después transferirlo a la población
-            int enemyType = data.genome.enemyType;
-            fitnessMap[enemyType] += fitness;
-            countMap[enemyType]++;
-        }
-        
-        // CORRECCIÓN: Aplicar el fitness a la población real
-        std::vector<Genome>& population = geneticAlgorithm.getPopulationRef();
-        for (auto& genome : population) {
-            int type = genome.enemyType;
-            if (countMap[type] > 0) {
-                // Asignar el fitness promedio para este tipo de enemigo
-                genome.fitness = fitnessMap[type] / countMap[type];
-            }
-        }
-        
-        // Evolucionar la población
+        harvestWaveFitness();
         geneticAlgorithm.evolve();
-        
-        // Limpiar datos de rendimiento para la siguiente oleada
-        enemyPerformanceData.clear();
     }
     
     // Generar enemigos basados en genomas
     const std::vector<Genome>& population = geneticAlgorithm.getPopulation();
     int enemiesToSpawn = std::min(enemiesPerWave, static_cast<int>(population.size()));
     
-    std::cout << "Generando " << enemiesToSpawn << " enemigos para la oleada #" << currentWave << std::endl;
+    LOG_INFO("Generando %d enemigos para la oleada #%d", enemiesToSpawn, currentWave);
+    if (currentPaths.empty()) {
+        LOG_ERROR("¡Error! No hay caminos para los enemigos de la oleada #%d", currentWave);
+        return;
+    }
+    reserveEnemies(enemiesToSpawn);
     
     for (int i = 0; i < enemiesToSpawn; i++) {
         // Elegir un camino aleatorio
-        int pathIndex = pathDist(rng);
-        if (pathIndex >= paths.size()) pathIndex = 0;
+        int pathIndex = rng.nextInt(0, static_cast<int>(currentPaths.size()) - 1);
+        if (pathIndex < 0 || pathIndex >= static_cast<int>(currentPaths.size())) pathIndex = 0;
         
         // Crear y registrar el enemigo
-        auto enemy = createEnemyFromGenome(population[i], paths[pathIndex]);
+        size_t enemy = createEnemyFromGenome(population[i], currentPaths[pathIndex]);
+        registerEnemy(enemy, population[i]);
+    }
+}
+
+void EnemyManager::harvestWaveFitness() {
+    // Fitness acumulado y número de registros por tipo de enemigo
+    float fitnessByType[ENEMY_TYPE_COUNT] = {};
+    int countByType[ENEMY_TYPE_COUNT] = {};
+    
+    // Procesar los datos de rendimiento en una pasada
+    for (const EnemyPerformance& data : enemyPerformanceData) {
+        float fitness = GeneticAlgorithm::calculateFitness(data.progressMade, data.damageDealt, data.timeAlive);
         
-        // Registrar el genoma para este enemigo
-        EnemyPerformance perf;
-        perf.id = nextEnemyId;
-        perf.genome = population[i];
-        perf.progressMade = 0.0f;
-        perf.damageDealt = 0.0f;
-        perf.timeAlive = 0.0f;
-        enemyPerformanceData.push_back(perf);
+        LOG_DEBUG("DEBUG - UpdateFitness con valores: progreso=%g, daño=%g, tiempo=%g",
+                  data.progressMade, data.damageDealt, data.timeAlive);
+        LOG_DEBUG("Fitness actualizado: %g", fitness);
         
-        // Asignar ID al enemigo y añadirlo a la lista
-        enemy->setId(nextEnemyId++);
-        enemies.push_back(std::move(enemy));
+        if (data.enemyType >= 0 && data.enemyType < ENEMY_TYPE_COUNT) {
+            fitnessByType[data.enemyType] += fitness;
+            countByType[data.enemyType]++;
+        }
+    }
+    
+    // Asignar a cada genoma de la población el fitness promedio de su tipo
+    std::vector<Genome>& population = geneticAlgorithm.getPopulationRef();
+    for (Genome& genome : population) {
+        int type = genome.enemyType;
+        if (type >= 0 && type < ENEMY_TYPE_COUNT && countByType[type] > 0) {
+            genome.fitness = fitnessByType[type] / countByType[type];
+        }
+    }
+    
+    // Limpiar datos de rendimiento para la siguiente oleada (los enemigos
+    // que siguen vivos se quedan sin registro)
+    enemyPerformanceData.clear();
+    for (size_t i = 0; i < enemies.size(); i++) {
+        enemies.record[i] = -1;
+    }
+}
+
+void EnemyManager::registerEnemy(size_t enemy, const Genome& genome) {
+    // Registrar el genoma para este enemigo
+    EnemyPerformance perf;
+    perf.enemy = enemies.getHandle(enemy);
+    perf.enemyType = genome.enemyType;
+    perf.progressMade = 0.0f;
+    perf.damageDealt = 0.0f;
+    perf.timeAlive = 0.0f;
+    enemies.record[enemy] = static_cast<int>(enemyPerformanceData.size());
+    enemyPerformanceData.push_back(perf);
+}
+
+void EnemyManager::reserveEnemies(size_t count) {
+    size_t needed = enemies.size() + count;
+    if (needed > enemies.capacity()) {
+        size_t capacity = std::max(needed, enemies.capacity() * 2);
+        enemies.reserve(capacity);
+        removedEnemies.reserve(capacity);
+        enemyPerformanceData.reserve(capacity);
     }
 }
 
 
 
-std::unique_ptr<Enemy> EnemyManager::createEnemyFromGenome(const Genome& genome, const std::vector<SDL_Point>& path) {
-    std::unique_ptr<Enemy> enemy;
-    
+size_t EnemyManager::createEnemyFromGenome(const Genome& genome, int pathId) {
     // Crear el tipo base de enemigo según el genoma
-    switch (genome.enemyType) {
-        case 0: // Ogro
-            enemy = std::make_unique<OgreEnemy>(entrancePoint.x, entrancePoint.y, path, ogreTexture);
-            break;
-        case 1: // Elfo Oscuro
-            enemy = std::make_unique<DarkElfEnemy>(entrancePoint.x, entrancePoint.y, path, darkElfTexture);
-            break;
-        case 2: // Harpía
-            enemy = std::make_unique<HarpyEnemy>(entrancePoint.x, entrancePoint.y, path, harpyTexture);
-            break;
-        case 3: // Mercenario
-            enemy = std::make_unique<MercenaryEnemy>(entrancePoint.x, entrancePoint.y, path, mercenaryTexture);
-            break;
-        default:
-            enemy = std::make_unique<OgreEnemy>(entrancePoint.x, entrancePoint.y, path, ogreTexture);
+    EnemyType type = EnemyType::OGRE;
+    if (genome.enemyType >= 0 && genome.enemyType < ENEMY_TYPE_COUNT) {
+        type = static_cast<EnemyType>(genome.enemyType);
     }
+    size_t enemy = createEnemy(type, pathId, 0.0f);
     
     // Aplicar atributos del genoma
-    enemy->setHealth(static_cast<int>(genome.health));
-    enemy->setSpeed(genome.speed);
-    enemy->setArrowResistance(genome.arrowResistance);
-    enemy->setMagicResistance(genome.magicResistance);
-    enemy->setArtilleryResistance(genome.artilleryResistance);
-    
-    std::cout << "Enemigo creado de genoma: Tipo=" << genome.enemyType 
-              << ", Vida=" << genome.health 
-              << ", Velocidad=" << genome.speed 
-              << ", Resistencias=" << genome.arrowResistance << "/" 
-              << genome.magicResistance << "/" 
-              << genome.artilleryResistance << std::endl;
+    enemies.health[enemy] = static_cast<int>(genome.health);
+    enemies.speed[enemy] = genome.speed;
+    enemies.resistance[static_cast<int>(DamageType::ARROW)][enemy] = genome.arrowResistance;
+    enemies.resistance[static_cast<int>(DamageType::MAGIC)][enemy] = genome.magicResistance;
+    enemies.resistance[static_cast<int>(DamageType::ARTILLERY)][enemy] = genome.artilleryResistance;
+    
+    LOG_DEBUG("Enemigo creado de genoma: Tipo=%d, Vida=%g, Velocidad=%g, Resistencias=%g/%g/%g",
+              genome.enemyType, genome.health, genome.speed,
+              genome.arrowResistance, genome.magicResistance, genome.artilleryResistance);
     
     return enemy;
 }
 
 
-void EnemyManager::registerEnemyDeath(int enemyId, float progressMade, float damageDealt, float timeAlive) {
-    // Encontrar el enemigo en los datos de rendimiento
-    for (auto& data : enemyPerformanceData) {
-        if (data.id == enemyId) {
-            // Actualizar datos de rendimiento
-            data.progressMade = progressMade;
-            data.damageDealt = damageDealt;
-            data.timeAlive = timeAlive;
-            
-            std::cout << "Rendimiento registrado para enemigo #" << enemyId 
-                      << ": Progreso=" << progressMade 
-                      << ", Daño=" << damageDealt 
-                      << ", Tiempo=" << timeAlive << std::endl;
-            return;
-        }
+void EnemyManager::registerEnemyDeath(size_t enemy, float progressMade, float damageDealt, float timeAlive) {
+    EnemyHandle handle = enemies.getHandle(enemy);
+    int record = enemies.record[enemy];
+    if (record < 0) {
+        LOG_WARN("Error: Enemigo #%u.%u no encontrado en los datos de rendimiento", handle.slot, handle.generation);
+        return;
     }
     
-    std::cerr << "Error: Enemigo #" << enemyId << " no encontrado en los datos de rendimiento" << std::endl;
+    // Actualizar datos de rendimiento (el tiempo se acumula en update)
+    EnemyPerformance& data = enemyPerformanceData[record];
+    data.progressMade = progressMade;
+    data.damageDealt = damageDealt;
+    data.timeAlive += timeAlive;
+    
+    LOG_DEBUG("Rendimiento registrado para enemigo #%u.%u: Progreso=%g, Daño=%g, Tiempo=%g",
+              handle.slot, handle.generation, progressMade, damageDealt, timeAlive);
 }
 
 
 void EnemyManager::update(int deltaTime) {
+    PROFILE_ZONE(ProfileZone::ENEMY_UPDATE);
+    
     // Actualizar temporizador de oleadas
-    waveTimer += deltaTime;
-    if (waveTimer >= waveInterval) {
-        spawnWave();
-        waveTimer = 0;
+    if (autoWaves) {
+        waveTimer += deltaTime;
+        if (waveTimer >= waveInterval) {
+            spawnWave();
+            waveTimer = 0;
+        }
     }
     
-    // Actualizar todos los enemigos
-    for (auto& enemy : enemies) {
-        enemy->update(deltaTime);
-        
-        // Actualizar tiempo de vida para el cálculo de fitness
-        for (auto& data : enemyPerformanceData) {
-            if (data.id == enemy->getId()) {
-                data.timeAlive += deltaTime;
-                // Actualizar el progreso en el camino
-                data.progressMade = enemy->getPathProgress();
-                break;
-            }
+    // Mover todos los enemigos
+    enemies.updateMovement(deltaTime, pathRegistry);
+    
+    // Actualizar tiempo de vida y progreso para el cálculo de fitness
+    for (size_t i = 0; i < enemies.size(); i++) {
+        if (enemies.record[i] >= 0) {
+            EnemyPerformance& data = enemyPerformanceData[enemies.record[i]];
+            data.timeAlive += deltaTime;
+            // Actualizar el progreso en el camino
+            data.progressMade = enemies.getPathProgress(i, pathRegistry);
         }
     }
     
     // Eliminar enemigos muertos y procesar oro
-    auto it = enemies.begin();
-    while (it != enemies.end()) {
-        if (!(*it)->isAlive()) {
+    removedEnemies.assign(enemies.size(), 0);
+    bool anyRemoved = false;
+    for (size_t i = 0; i < enemies.size(); i++) {
+        if (!enemies.isAlive(i)) {
             // Registrar rendimiento final
-            registerEnemyDeath((*it)->getId(), 
-                              (*it)->getPathProgress(), 
-                              (*it)->getDamageDealt(), 
+            registerEnemyDeath(i, 
+                              enemies.getPathProgress(i, pathRegistry), 
+                              enemies.damageDealt[i], 
                               0.0f); // El tiempo ya se ha acumulado
             
             // Añadir oro al matar un enemigo
-            resources->addGold((*it)->getGoldValue());
-            std::cout << "Enemigo #" << (*it)->getId() << " eliminado. +" << (*it)->getGoldValue() << " oro." << std::endl;
-            it = enemies.erase(it);
-        } else if ((*it)->hasReachedEnd()) {
+            resources->addGold(enemies.goldValue[i]);
+            LOG_INFO("Enemigo #%u.%u eliminado. +%d oro.", enemies.getHandle(i).slot, enemies.getHandle(i).generation,
+                     enemies.goldValue[i]);
+            removedEnemies[i] = 1;
+            anyRemoved = true;
+        } else if (enemies.reachedEnd[i]) {
             // El enemigo llegó al final - éxito máximo para su fitness
-            registerEnemyDeath((*it)->getId(), 
+            registerEnemyDeath(i, 
                               1.0f, // Progreso máximo
-                              (*it)->getDamageDealt(), 
+                              enemies.damageDealt[i], 
                               0.0f); // El tiempo ya se ha acumulado
             
-            std::cout << "¡Enemigo #" << (*it)->getId() << " ha cruzado el puente!" << std::endl;
-            it = enemies.erase(it);
+            LOG_INFO("¡Enemigo #%u.%u ha cruzado el puente!", enemies.getHandle(i).slot, enemies.getHandle(i).generation);
+            removedEnemies[i] = 1;
+            anyRemoved = true;
             // Aquí se podría implementar un sistema de vidas
-        } else {
-            ++it;
         }
     }
+    if (anyRemoved) {
+        for (size_t i = 0; i < enemies.size(); i++) {
+            if (removedEnemies[i]) {
+                pathRegistry.release(enemies.pathId[i]);
+            }
+        }
+        enemies.removeMarked(removedEnemies);
+    }
 }
 
 void EnemyManager::render(SDL_Renderer* renderer) const {
+    PROFILE_ZONE(ProfileZone::ENEMY_RENDER);
+    
+    const int size = EnemyStore::ENEMY_SIZE;
+    
     // Renderizar todos los enemigos
-    for (const auto& enemy : enemies) {
-        enemy->render(renderer);
+    for (size_t i = 0; i < enemies.size(); i++) {
+        if (!enemies.isAlive(i)) {
+            continue;
+        }
+        
+        float x, y;
+        enemies.getPosition(i, pathRegistry, x, y);
+        SDL_Rect destRect = {static_cast<int>(x - size/2), static_cast<int>(y - size/2), size, size};
+        
+        // Dibujar el enemigo usando su textura
+        SDL_Texture* texture = getTexture(enemies.type[i]);
+        if (texture) {
+            SDL_RenderCopy(renderer, texture, NULL, &destRect);
+        } else {
+            // Método alternativo usando un rectángulo de color
+            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255); // Rojo por defecto
+            SDL_RenderFillRect(renderer, &destRect);
+        }
+        
+        // Barra de vida bien visible
+        int healthBarHeight = 10;
+        float healthPercentage = static_cast<float>(enemies.health[i]) / 100.0f;
+        
+        // Fondo de la barra de vida (gris oscuro)
+        SDL_Rect healthBarBg = {destRect.x, destRect.y - 15, size, healthBarHeight};
+        SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
+        SDL_RenderFillRect(renderer, &healthBarBg);
+        
+        // Barra de vida actual (verde a rojo basado en la vida)
+        SDL_Rect healthBarFg = {destRect.x, destRect.y - 15, static_cast<int>(size * healthPercentage), healthBarHeight};
+        
+        // Color dinámico: verde (100% vida) -> amarillo (50% vida) -> rojo (0% vida)
+        Uint8 r = static_cast<Uint8>((1.0f - healthPercentage) * 255);
+        Uint8 g = static_cast<Uint8>(healthPercentage * 255);
+        SDL_SetRenderDrawColor(renderer, r, g, 0, 255);
+        SDL_RenderFillRect(renderer, &healthBarFg);
+        
+        // Borde negro para mejor visibilidad
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderDrawRect(renderer, &healthBarBg);
     }
 }
 
 void EnemyManager::processTowerAttacks(const std::vector<std::unique_ptr<Tower>>& towers, Game* game) {
+    PROFILE_ZONE(ProfileZone::TOWER_ATTACKS);
+    
     // Para depuración
     bool foundTargets = false;
     
     // DEPURACIÓN EXTREMA: Mostrar posiciones exactas
-    std::cout << "===== DEPURACIÓN EXTREMA =====" << std::endl;
-    std::cout << "Número de torres: " << towers.size() << std::endl;
-    std::cout << "Número de enemigos: " << enemies.size() << std::endl;
+    LOG_DEBUG("===== DEPURACIÓN EXTREMA =====");
+    LOG_DEBUG("Número de torres: %zu", towers.size());
+    LOG_DEBUG("Número de enemigos: %zu", enemies.size());
+    
+    // Indexar los enemigos por celda con sus posiciones actuales
+    enemies.updatePositions(pathRegistry);
+    enemyGrid.rebuild(enemies.x, enemies.y);
     
     // Iterar por todas las torres
     for (const auto& tower : towers) {
@@ -524,33 +607,50 @@ void EnemyManager::processTowerAttacks(const std::vector<std::unique_ptr<Tower>>
         int towerCenterX = (tower->getCol() * 50) + 25;
         int towerCenterY = (tower->getRow() * 50) + 25;
         int towerRange = tower->getRange();
+        TowerType towerType = tower->getKind();
+        const TowerKind& towerKind = getTowerKind(towerType);
         
-        std::cout << "Torre " << tower->getType() << " en (" << towerCenterX << "," << towerCenterY 
-                  << "), puede atacar: " << (tower->canAttack() ? "SÍ" : "NO") << std::endl;
+        LOG_DEBUG("Torre %s en (%d,%d), puede atacar: %s", towerKind.name, towerCenterX, towerCenterY,
+                  tower->canAttack() ? "SÍ" : "NO");
         
         // Verificar si la torre puede atacar según su temporizador interno
         if (tower->canAttack()) {
             // Verificar si se activará un ataque especial
             bool specialAttack = tower->isSpecialAttackReady();
             
-            // Buscar enemigos para atacar
+            // Buscar enemigos para atacar (solo en las celdas que cubre el alcance)
             if (!enemies.empty()) {
-                for (auto& enemy : enemies) {
-                    if (enemy->isAlive()) {
-                        SDL_Point enemyPos = enemy->getPosition();
+                targetCandidates.clear();
+                enemyGrid.queryCircle(static_cast<float>(towerCenterX), static_cast<float>(towerCenterY),
+                                      static_cast<float>(towerRange), targetCandidates);
+                
+                for (uint32_t enemy : targetCandidates) {
+                    if (enemies.isAlive(enemy)) {
+                        SDL_Point enemyPos = {static_cast<int>(enemies.x[enemy]), static_cast<int>(enemies.y[enemy])};
+                        
+                        // Tramo del camino en el que está el enemigo respecto al alcance de la torre
+                        int pathId = enemies.pathId[enemy];
+                        const std::vector<CoverageKind>& coverage = tower->getPathCoverage().getKinds(
+                            pathId, pathRegistry.get(pathId), towerCenterX, towerCenterY, towerRange,
+                            pathRegistry.getSerial(pathId));
+                        CoverageKind kind = PathCoverage::classify(coverage, enemies.pathIndex[enemy],
+                                                                   enemies.getStepDistance(enemy));
                         
-                        // Calcular distancia real usando la fórmula euclidiana
-                        float dx = enemyPos.x - towerCenterX;
-                        float dy = enemyPos.y - towerCenterY;
-                        float distance = std::sqrt(dx*dx + dy*dy);
+                        // Solo en los tramos que cruzan el borde del alcance se calcula la distancia (al cuadrado)
+                        bool inRange = kind == CoverageKind::INSIDE;
+                        if (kind == CoverageKind::PARTIAL) {
+                            int dx = enemyPos.x - towerCenterX;
+                            int dy = enemyPos.y - towerCenterY;
+                            inRange = dx*dx + dy*dy <= towerRange * towerRange;
+                        }
                         
                         // Información detallada de la posición del enemigo
-                        std::cout << "  Enemigo " << enemy->getType() << " en (" << enemyPos.x << "," 
-                                << enemyPos.y << "), Distancia total: " << distance 
-                                << ", Rango de la torre: " << towerRange << std::endl;
+                        LOG_DEBUG("  Enemigo %s en (%d,%d), Tramo: %d, Rango de la torre: %d, Al alcance: %s",
+                                  enemies.getTypeName(enemy), enemyPos.x, enemyPos.y, enemies.pathIndex[enemy],
+                                  towerRange, inRange ? "SÍ" : "NO");
                         
                         // Usar el rango completo de la torre
-                        if (distance <= towerRange) {
+                        if (inRange) {
                             foundTargets = true;
                             
                             // Determinar tipo de ataque
@@ -560,30 +660,21 @@ void EnemyManager::processTowerAttacks(const std::vector<std::unique_ptr<Tower>>
                                 
                                 // IMPORTANTE: Aplicar daño al enemigo (modificar según tipo de torre)
                                 int baseDamage = tower->getDamage();
-                                int multiplier = 1;
                                 
                                 // Aplicar multiplicador según tipo de torre
-                                if (tower->getType() == "Arquero") {
-                                    multiplier = 3; // Lluvia de flechas
-                                } else if (tower->getType() == "Mago") {
-                                    multiplier = 2; // Explosión arcana
-                                } else if (tower->getType() == "Artillero") {
-                                    multiplier = 2; // Proyectil aturdidor
-                                }
-                                
-                                int damage = baseDamage * multiplier;
-                                std::cout << ">>> APLICANDO DAÑO ESPECIAL de " << damage << " al " << enemy->getType() << " <<<" << std::endl;
-                                int actualDamage = enemy->takeDamage(damage, tower->getType());
+                                int damage = baseDamage * towerKind.specialMultiplier;
+                                LOG_DEBUG(">>> APLICANDO DAÑO ESPECIAL de %d al %s <<<", damage, enemies.getTypeName(enemy));
+                                int actualDamage = enemies.takeDamage(enemy, damage, towerType);
                                 
                                 // Mostrar información de daño
-                                std::cout << "¡¡ATAQUE ESPECIAL EXITOSO!! " << tower->getType() << " ataca a " << enemy->getType() 
-                                        << " causando " << actualDamage << " de daño!" << std::endl;
+                                LOG_DEBUG("¡¡ATAQUE ESPECIAL EXITOSO!! %s ataca a %s causando %d de daño!",
+                                          towerKind.name, enemies.getTypeName(enemy), actualDamage);
                                 
                                 // Añadir mensaje en pantalla
                                 if (game) {
-                                    std::string message = "¡ESPECIAL! " + tower->getType() + " → " + enemy->getType() + 
+                                    std::string message = std::string("¡ESPECIAL! ") + towerKind.name + " → " + enemies.getTypeName(enemy) + 
                                                         " (-" + std::to_string(actualDamage) + " HP) | Vida: " + 
-                                                        std::to_string(enemy->getHealth()) + " HP";
+                                                        std::to_string(enemies.health[enemy]) + " HP";
                                     
                                     // Color brillante para ataques especiales
                                     SDL_Color color = {255, 255, 0, 255}; // Amarillo brillante
@@ -595,27 +686,33 @@ void EnemyManager::processTowerAttacks(const std::vector<std::unique_ptr<Tower>>
                                 
                                 // IMPORTANTE: Aplicar daño normal al enemigo
                                 int damage = tower->getDamage();
-                                std::cout << ">>> APLICANDO DAÑO de " << damage << " al " << enemy->getType() << " <<<" << std::endl;
-                                int actualDamage = enemy->takeDamage(damage, tower->getType());
+                                LOG_DEBUG(">>> APLICANDO DAÑO de %d al %s <<<", damage, enemies.getTypeName(enemy));
+                                int actualDamage = enemies.takeDamage(enemy, damage, towerType);
                                 
                                 // Mostrar información de daño
-                                std::cout << "¡¡ATAQUE EXITOSO!! " << tower->getType() << " ataca a " << enemy->getType() 
-                                        << " causando " << actualDamage << " de daño!" << std::endl;
+                                LOG_DEBUG("¡¡ATAQUE EXITOSO!! %s ataca a %s causando %d de daño!",
+                                          towerKind.name, enemies.getTypeName(enemy), actualDamage);
                                 
                                 // Añadir mensaje en pantalla
                                 if (game) {
-                                    std::string message = tower->getType() + " → " + enemy->getType() + 
+                                    std::string message = std::string(towerKind.name) + " → " + enemies.getTypeName(enemy) + 
                                                         " (-" + std::to_string(actualDamage) + " HP) | Vida: " + 
-                                                        std::to_string(enemy->getHealth()) + " HP";
+                                                        std::to_string(enemies.health[enemy]) + " HP";
                                     
                                     // Color según el tipo de torre
                                     SDL_Color color = {255, 255, 255, 255}; // Blanco por defecto
-                                    if (tower->getType() == "Arquero") {
-                                        color = {0, 150, 0, 255}; // Verde para arqueros
-                                    } else if (tower->getType() == "Mago") {
-                                        color = {0, 0, 200, 255}; // Azul para magos
-                                    } else if (tower->getType() == "Artillero") {
-                                        color = {200, 0, 0, 255}; // Rojo para artilleros
+                                    switch (towerType) {
+                                        case TowerType::ARCHER:
+                                            color = {0, 150, 0, 255}; // Verde para arqueros
+                                            break;
+                                        case TowerType::MAGE:
+                                            color = {0, 0, 200, 255}; // Azul para magos
+                                            break;
+                                        case TowerType::ARTILLERY:
+                                            color = {200, 0, 0, 255}; // Rojo para artilleros
+                                            break;
+                                        default:
+                                            break;
                                     }
                                     
                                     game->addAttackMessage(message, color);
@@ -626,14 +723,14 @@ void EnemyManager::processTowerAttacks(const std::vector<std::unique_ptr<Tower>>
                             tower->resetTimer();
                             
                             // Si el enemigo murió, dar oro y mostrar mensaje
-                            if (!enemy->isAlive()) {
-                                int goldGained = enemy->getGoldValue();
+                            if (!enemies.isAlive(enemy)) {
+                                int goldGained = enemies.goldValue[enemy];
                                 resources->addGold(goldGained);
-                                std::cout << "¡¡ENEMIGO ELIMINADO!! +" << goldGained << " de oro." << std::endl;
+                                LOG_INFO("¡¡ENEMIGO ELIMINADO!! +%d de oro.", goldGained);
                                 
                                 // Mensaje de enemigo eliminado
                                 if (game) {
-                                    std::string message = "¡" + enemy->getType() + " eliminado! +" + 
+                                    std::string message = "¡" + std::string(enemies.getTypeName(enemy)) + " eliminado! +" + 
                                                          std::to_string(goldGained) + " oro";
                                     SDL_Color goldColor = {255, 215, 0, 255}; // Dorado
                                     game->addAttackMessage(message, goldColor);
@@ -650,11 +747,53 @@ void EnemyManager::processTowerAttacks(const std::vector<std::unique_ptr<Tower>>
     }
     
     if (!foundTargets && !enemies.empty()) {
-        std::cout << "¡Ningún enemigo en rango de ninguna torre! (Tenemos " << enemies.size() << " enemigos activos)" << std::endl;
+        LOG_DEBUG("¡Ningún enemigo en rango de ninguna torre! (Tenemos %zu enemigos activos)", enemies.size());
     }
 }
 
 
+EnemyHandle EnemyManager::spawnEnemyFromGenome(const Genome& genome) {
+    if (currentPaths.empty()) {
+        return NO_ENEMY;
+    }
+    
+    // Elegir un camino aleatorio
+    int pathIndex = rng.nextInt(0, static_cast<int>(currentPaths.size()) - 1);
+    reserveEnemies(1);
+    size_t enemy = createEnemyFromGenome(genome, currentPaths[pathIndex]);
+    registerEnemy(enemy, genome);
+    return enemies.getHandle(enemy);
+}
+
+void EnemyManager::clearEnemies() {
+    for (size_t i = 0; i < enemies.size(); i++) {
+        pathRegistry.release(enemies.pathId[i]);
+    }
+    enemies.clear();
+    enemyPerformanceData.clear();
+}
+
+float EnemyManager::getEnemyFitness(EnemyHandle enemy) const {
+    // Enemigo aún en el almacén: su registro está indexado directamente
+    int index = enemies.indexOf(enemy);
+    if (index >= 0) {
+        int record = enemies.record[index];
+        if (record < 0) {
+            return 0.0f;
+        }
+        const EnemyPerformance& data = enemyPerformanceData[record];
+        return GeneticAlgorithm::calculateFitness(data.progressMade, data.damageDealt, data.timeAlive);
+    }
+
+    // Ya eliminado: solo queda buscarlo en los registros
+    for (const auto& data : enemyPerformanceData) {
+        if (data.enemy == enemy) {
+            return GeneticAlgorithm::calculateFitness(data.progressMade, data.damageDealt, data.timeAlive);
+        }
+    }
+    return 0.0f;
+}
+
 int EnemyManager::getEnemiesKilled() const {
     // Implementación para estadísticas
     // Por ahora devolvemos 0, pero en el futuro mantendríamos un contador
@@ -663,12 +802,14 @@ int EnemyManager::getEnemiesKilled() const {
 
 void EnemyManager::spawnTestEnemies() {
     // Para pruebas: generar un enemigo de cada tipo
-    if (!paths.empty()) {
-        enemies.push_back(std::make_unique<OgreEnemy>(entrancePoint.x, entrancePoint.y, paths[0], ogreTexture));
-        enemies.push_back(std::make_unique<DarkElfEnemy>(entrancePoint.x - 50, entrancePoint.y, paths[0], darkElfTexture));
-        enemies.push_back(std::make_unique<HarpyEnemy>(entrancePoint.x - 100, entrancePoint.y, paths[0], harpyTexture));
-        enemies.push_back(std::make_unique<MercenaryEnemy>(entrancePoint.x - 150, entrancePoint.y, paths[0], mercenaryTexture));
+    if (!currentPaths.empty()) {
+        int mainPath = currentPaths[0];
+        // En fila detrás de la entrada (distancias negativas)
+        createEnemy(EnemyType::OGRE, mainPath, 0.0f);
+        createEnemy(EnemyType::DARK_ELF, mainPath, -50.0f);
+        createEnemy(EnemyType::HARPY, mainPath, -100.0f);
+        createEnemy(EnemyType::MERCENARY, mainPath, -150.0f);
         
-        std::cout << "Enemigos de prueba generados" << std::endl;
+        LOG_INFO("Enemigos de prueba generados");
     }
 }
\ No newline at end of file
@@ -5,12 +5,19 @@
 #include <SDL2/SDL_image.h>
 #include <vector>
 #include <memory>
-#include <random>
-#include "Enemy.h"
+#include <cstdint>
+#include "EnemyStore.h"
+#include "EnemyTypes.h"
 #include "GameBoard.h"
 #include "ResourceSystem.h"
 #include "AStar.h"
 #include "GeneticAlgorithm.h"
+#include "RandomStream.h"
+#include "SpatialHash.h"
+#include "FlowField.h"
+#include "LPAStar.h"
+#include "KShortestPaths.h"
+#include "PathRegistry.h"
 
 
 
@@ -18,33 +25,67 @@
 class Tower;
 class Game;  // Añadir esta línea
 
-enum class EnemyType {
-    OGRE,
-    DARK_ELF,
-    HARPY,
-    MERCENARY
-};
-
 class EnemyManager {
 private:
     GeneticAlgorithm geneticAlgorithm;
 
     struct EnemyPerformance {
-        int id;
-        Genome genome;
+        EnemyHandle enemy;   // Enemigo al que pertenece (caduca al eliminarlo)
+        int enemyType;       // Tipo del genoma (el fitness se reparte por tipo)
         float progressMade;
         float damageDealt;
         float timeAlive;
     };  
 
+    // Registros de rendimiento de la oleada (cada enemigo guarda el índice del suyo)
     std::vector<EnemyPerformance> enemyPerformanceData;
-    int nextEnemyId;
 
-    // Método para crear un enemigo basado en un genoma
-    std::unique_ptr<Enemy> createEnemyFromGenome(const Genome& genome, const std::vector<SDL_Point>& path);
+    // Enemigos para los que se reserva sitio al empezar (luego crece al doble)
+    static const size_t INITIAL_ENEMY_CAPACITY = 64;
+
+    // Método para crear un enemigo basado en un genoma (devuelve su posición en el almacén)
+    size_t createEnemyFromGenome(const Genome& genome, int pathId);
+
+    // Crea el registro de rendimiento del enemigo de la posición 'enemy'
+    void registerEnemy(size_t enemy, const Genome& genome);
+
+    // Pasa el fitness de los registros de la oleada a la población (promedio
+    // por tipo de enemigo) y vacía los registros
+    void harvestWaveFitness();
 
-    std::vector<std::unique_ptr<Enemy>> enemies;
-    std::vector<std::vector<SDL_Point>> paths;  // Caminos posibles
+    // Reserva sitio para 'count' enemigos más sin que el almacén crezca durante la oleada
+    void reserveEnemies(size_t count);
+
+    // Enemigos activos en estructura de arrays
+    EnemyStore enemies;
+    std::vector<uint8_t> removedEnemies;        // Marcas de eliminación del tick actual
+    
+    // Índice espacial de enemigos por celda para buscar objetivos de las torres
+    SpatialHash enemyGrid;
+    std::vector<uint32_t> targetCandidates;     // Resultado reutilizable de las consultas
+    std::vector<std::vector<SDL_Point>> paths;  // Caminos en construcción (generatePathsWithAStar)
+    
+    // Caminos compartidos: los enemigos guardan el id de su camino en el
+    // registro, así que los ya lanzados conservan su camino aunque se regeneren
+    // los caminos al colocar una torre (se libera cuando nadie lo usa)
+    PathRegistry pathRegistry;
+    std::vector<int> currentPaths;  // Ids de los caminos posibles ahora (con una referencia cada uno)
+    
+    // Distancias hasta el puente (se recalculan una vez por cambio del tablero)
+    // para desviar a los enemigos cuyo camino queda bloqueado
+    FlowField flowField;
+    std::vector<int> pathBlockedAt;   // Último punto bloqueado de cada camino (-1 = libre)
+    std::vector<int> rerouteByCell;   // Camino nuevo desde cada celda en el desvío actual
+    
+    // Planificador incremental del camino principal: conserva su búsqueda entre
+    // cambios del tablero y solo repara las celdas afectadas
+    LPAStar mainPlanner;
+    
+    // Caminos alternativos diversos (Yen), hasta 3 contando el principal. Con un
+    // solo hilo: cada hilo de FitnessEvaluator tiene su propia simulación, y
+    // repartir además las búsquedas de desvío sobresuscribiría los núcleos
+    KShortestPaths alternativePlanner;
+    uint32_t pathsBoardVersion;       // Versión del tablero con la que se generaron los caminos actuales
     
     // Texturas para cada tipo de enemigo
     SDL_Texture* ogreTexture;
@@ -52,9 +93,6 @@ private:
     SDL_Texture* harpyTexture;
     SDL_Texture* mercenaryTexture;
     
-    // Punto de entrada (inicio del camino)
-    SDL_Point entrancePoint;
-    
     // Sistema de recursos para añadir oro al matar enemigos
     ResourceSystem* resources;
     
@@ -63,27 +101,29 @@ private:
     int waveInterval;    // Tiempo entre oleadas (ms)
     int enemiesPerWave;  // Enemigos por oleada
     int currentWave;     // Número de oleada actual
+    bool autoWaves;      // Lanzar oleadas automáticamente con el temporizador
+    
+    // Generador de números aleatorios (flujo propio derivado de la semilla de sesión)
+    RandomStream rng;
     
-    // Generador de números aleatorios
-    std::mt19937 rng;
-    std::uniform_int_distribution<int> enemyTypeDist;
-    std::uniform_int_distribution<int> pathDist;
+    // Crear un nuevo enemigo según el tipo (devuelve su posición en el almacén)
+    size_t createEnemy(EnemyType type, int pathId, float startDistance);
     
-    // Crear un nuevo enemigo según el tipo
-    std::unique_ptr<Enemy> createEnemy(EnemyType type, const std::vector<SDL_Point>& path);
+    // Textura de cada tipo de enemigo
+    SDL_Texture* getTexture(EnemyType type) const;
     
     // Genera caminos usando A*
     void generatePathsWithAStar(GameBoard* board);
 
-    // Genera caminos alternativos
-    void generateAlternativePaths(GameBoard* board, SDL_Point entrance, SDL_Point exit);
+    // Desvía por el campo de distancias a los enemigos con celdas bloqueadas por delante
+    void rerouteBlockedEnemies(GameBoard* board);
 
-    // Verifica si un camino es suficientemente diferente de los existentes
-    bool isPathSufficientlyDifferent(const std::vector<SDL_Point>& newPath);
+    // Genera caminos alternativos (desviaciones del camino principal)
+    void generateAlternativePaths(GameBoard* board, const std::vector<SDL_Point>& mainGridPath);
 
 
 public:
-    EnemyManager(GameBoard* board, ResourceSystem* res, SDL_Renderer* renderer);
+    EnemyManager(GameBoard* board, ResourceSystem* res, SDL_Renderer* renderer, uint64_t seed = 0);
     ~EnemyManager();
     
     // Cargar texturas para los enemigos
@@ -105,7 +145,7 @@ public:
     void processTowerAttacks(const std::vector<std::unique_ptr<Tower>>& towers, Game* game = nullptr);
     
     // Obtener estadísticas
-    int getEnemyCount() const { return enemies.size(); }
+    int getEnemyCount() const { return static_cast<int>(enemies.size()); }
     int getEnemiesKilled() const;  // Implementar para estadísticas
     int getCurrentWave() const { return currentWave; }
     
@@ -120,11 +160,24 @@ public:
     float getWorstFitness() const { return geneticAlgorithm.getWorstFitness(); }
     float getMutationRate() const { return geneticAlgorithm.getMutationRate(); }
         
-    // Registrar rendimiento de un enemigo
-    void registerEnemyDeath(int enemyId, float progressMade, float damageDealt, float timeAlive);
+    // Registrar rendimiento del enemigo de la posición 'enemy'
+    void registerEnemyDeath(size_t enemy, float progressMade, float damageDealt, float timeAlive);
 
-    // Implementación de spawnEnemyFromGenome
-    void spawnEnemyFromGenome(const Genome& genome);
+    // Crear un enemigo a partir de un genoma (devuelve su handle, NO_ENEMY si no hay caminos)
+    EnemyHandle spawnEnemyFromGenome(const Genome& genome);
+    
+    // Eliminar todos los enemigos y sus datos de rendimiento
+    void clearEnemies();
+    
+    // Fitness actual de un enemigo según sus datos de rendimiento (0 si no existe).
+    // El registro se conserva aunque el enemigo ya se haya eliminado
+    float getEnemyFitness(EnemyHandle enemy) const;
+    
+    // Activar o desactivar las oleadas automáticas (evaluación de genomas)
+    void setAutoWaves(bool enabled) { autoWaves = enabled; }
+    
+    // Acceso al algoritmo genético
+    GeneticAlgorithm& getGeneticAlgorithm() { return geneticAlgorithm; }
 };
 
 #endif // ENEMY_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,259 @@
+#include "EnemyStore.h"
+#include <algorithm>
+#include "Logger.h"
+
+void EnemyStore::reserve(size_t capacity) {
+    x.reserve(capacity);
+    y.reserve(capacity);
+    health.reserve(capacity);
+    speed.reserve(capacity);
+    for (int d = 0; d < DAMAGE_TYPE_COUNT; d++) {
+        resistance[d].reserve(capacity);
+    }
+    pathId.reserve(capacity);
+    distance.reserve(capacity);
+    segment.reserve(capacity);
+    pathIndex.reserve(capacity);
+    reachedEnd.reserve(capacity);
+    type.reserve(capacity);
+    goldValue.reserve(capacity);
+    damageDealt.reserve(capacity);
+    record.reserve(capacity);
+    indexToSlot.reserve(capacity);
+
+    // Tabla de handles: nunca hay más slots que enemigos a la vez
+    slotToIndex.reserve(capacity);
+    slotGeneration.reserve(capacity);
+    freeSlots.reserve(capacity);
+}
+
+size_t EnemyStore::add(EnemyType enemyType, int path, float startDistance) {
+    const EnemyArchetype& archetype = getEnemyArchetype(enemyType);
+
+    x.push_back(0.0f);
+    y.push_back(0.0f);
+    positionsStale = true;
+    health.push_back(archetype.health);
+    speed.push_back(archetype.speed);
+    for (int d = 0; d < DAMAGE_TYPE_COUNT; d++) {
+        resistance[d].push_back(archetype.resistances[d]);
+    }
+    pathId.push_back(path);
+    distance.push_back(startDistance);
+    segment.push_back(0);
+    pathIndex.push_back(0);
+    reachedEnd.push_back(0);
+    type.push_back(enemyType);
+    goldValue.push_back(archetype.goldValue);
+    damageDealt.push_back(0.0f);
+    record.push_back(-1);
+
+    size_t index = x.size() - 1;
+
+    // Reutilizar un slot libre o crear uno nuevo
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(slotToIndex.size());
+        slotToIndex.push_back(0);
+        slotGeneration.push_back(0);
+    }
+    slotToIndex[slot] = static_cast<uint32_t>(index);
+    indexToSlot.push_back(slot);
+
+    return index;
+}
+
+void EnemyStore::moveEnemy(size_t from, size_t to) {
+    x[to] = x[from];
+    y[to] = y[from];
+    health[to] = health[from];
+    speed[to] = speed[from];
+    for (int d = 0; d < DAMAGE_TYPE_COUNT; d++) {
+        resistance[d][to] = resistance[d][from];
+    }
+    pathId[to] = pathId[from];
+    distance[to] = distance[from];
+    segment[to] = segment[from];
+    pathIndex[to] = pathIndex[from];
+    reachedEnd[to] = reachedEnd[from];
+    type[to] = type[from];
+    goldValue[to] = goldValue[from];
+    damageDealt[to] = damageDealt[from];
+    record[to] = record[from];
+    indexToSlot[to] = indexToSlot[from];
+    slotToIndex[indexToSlot[to]] = static_cast<uint32_t>(to);
+}
+
+void EnemyStore::resizeColumns(size_t count) {
+    x.resize(count);
+    y.resize(count);
+    health.resize(count);
+    speed.resize(count);
+    for (int d = 0; d < DAMAGE_TYPE_COUNT; d++) {
+        resistance[d].resize(count);
+    }
+    pathId.resize(count);
+    distance.resize(count);
+    segment.resize(count);
+    pathIndex.resize(count);
+    reachedEnd.resize(count);
+    type.resize(count);
+    goldValue.resize(count);
+    damageDealt.resize(count);
+    record.resize(count);
+    indexToSlot.resize(count);
+}
+
+void EnemyStore::releaseSlot(size_t i) {
+    // Invalidar el handle del enemigo eliminado
+    uint32_t slot = indexToSlot[i];
+    slotGeneration[slot]++;
+    freeSlots.push_back(slot);
+}
+
+void EnemyStore::remove(size_t i) {
+    size_t last = x.size() - 1;
+    releaseSlot(i);
+
+    // Mover el último enemigo a la posición i
+    if (i != last) {
+        moveEnemy(last, i);
+    }
+    resizeColumns(last);
+}
+
+void EnemyStore::removeMarked(const std::vector<uint8_t>& marked) {
+    // Compactar en una sola pasada conservando el orden de los supervivientes
+    size_t write = 0;
+    for (size_t read = 0; read < x.size(); read++) {
+        if (marked[read]) {
+            releaseSlot(read);
+            continue;
+        }
+        if (write != read) {
+            moveEnemy(read, write);
+        }
+        write++;
+    }
+    resizeColumns(write);
+}
+
+void EnemyStore::clear() {
+    while (!empty()) {
+        remove(size() - 1);
+    }
+}
+
+EnemyHandle EnemyStore::getHandle(size_t i) const {
+    uint32_t slot = indexToSlot[i];
+    return {slot, slotGeneration[slot]};
+}
+
+bool EnemyStore::isValid(EnemyHandle handle) const {
+    return handle.slot < slotGeneration.size() && slotGeneration[handle.slot] == handle.generation;
+}
+
+int EnemyStore::indexOf(EnemyHandle handle) const {
+    if (!isValid(handle)) {
+        return -1;
+    }
+    return static_cast<int>(slotToIndex[handle.slot]);
+}
+
+void EnemyStore::setPath(size_t i, int path) {
+    pathId[i] = path;
+    distance[i] = 0.0f;
+    segment[i] = 0;
+    pathIndex[i] = 0;
+    positionsStale = true;
+}
+
+void EnemyStore::updateMovement(int deltaTime, const PathRegistry& paths) {
+    float seconds = deltaTime / 1000.0f;
+    lastStepSeconds = seconds;
+
+    for (size_t i = 0; i < x.size(); i++) {
+        const PathTrack& track = paths.getTrack(pathId[i]);
+        if (health[i] <= 0 || reachedEnd[i] || track.empty()) {
+            continue;
+        }
+
+        // Avanzar según la velocidad y el tiempo transcurrido
+        float travelled = distance[i] + speed[i] * seconds;
+        if (travelled >= track.getTotalLength()) {
+            travelled = track.getTotalLength();
+            reachedEnd[i] = 1;
+        }
+        distance[i] = travelled;
+        segment[i] = track.advanceSegment(segment[i], travelled);
+        pathIndex[i] = track.advancePoint(pathIndex[i], travelled);
+    }
+    positionsStale = true;
+}
+
+void EnemyStore::updatePositions(const PathRegistry& paths) {
+    if (!positionsStale) {
+        return;
+    }
+    for (size_t i = 0; i < x.size(); i++) {
+        const PathTrack& track = paths.getTrack(pathId[i]);
+        if (!track.empty()) {
+            track.positionAt(segment[i], distance[i], x[i], y[i]);
+        }
+    }
+    positionsStale = false;
+}
+
+void EnemyStore::getPosition(size_t i, const PathRegistry& paths, float& outX, float& outY) const {
+    const PathTrack& track = paths.getTrack(pathId[i]);
+    if (track.empty()) {
+        outX = x[i];
+        outY = y[i];
+        return;
+    }
+    track.positionAt(segment[i], distance[i], outX, outY);
+}
+
+float EnemyStore::getPathProgress(size_t i, const PathRegistry& paths) const {
+    float totalLength = paths.getTrack(pathId[i]).getTotalLength();
+    if (totalLength <= 0.0f) {
+        return 0.0f;
+    }
+    return std::max(0.0f, std::min(1.0f, distance[i] / totalLength));
+}
+
+int EnemyStore::takeDamage(size_t i, int damage, TowerType towerType) {
+    DamageType damageType = getTowerKind(towerType).damageType;
+    
+    // Algunos tipos de daño no alcanzan a ciertos enemigos (la artillería a los voladores)
+    if (isImmune(type[i], damageType)) {
+        return 0;
+    }
+
+    // Aplicar resistencia según el tipo de daño de la torre
+    float resistance = this->resistance[static_cast<int>(damageType)][i];
+
+    // Calcular daño real después de aplicar resistencia
+    int actualDamage = static_cast<int>(damage * (1.0f - resistance));
+
+    // Guardar valor anterior de vida para depuración
+    int oldHealth = health[i];
+
+    // Aplicar daño
+    health[i] -= actualDamage;
+    if (health[i] < 0) health[i] = 0;
+
+    // Si el enemigo llega al final, registra daño al jugador para su fitness
+    if (reachedEnd[i]) {
+        damageDealt[i] += 10.0f; // Valor arbitrario de daño al jugador
+    }
+
+    LOG_DEBUG("APLICANDO DAÑO: %s → %s | Daño base: %d | Resistencia: %g | Daño real: %d | Vida: %d → %d (%d%% restante)",
+              getTowerKind(towerType).name, getTypeName(i), damage, resistance, actualDamage,
+              oldHealth, health[i], oldHealth > 0 ? (health[i] * 100 / oldHealth) : 0);
+
+    return actualDamage;
+}
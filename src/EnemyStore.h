@@ -0,0 +1,104 @@
+#ifndef ENEMY_STORE_H
+#define ENEMY_STORE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "EnemyTypes.h"
+#include "PathRegistry.h"
+
+// Almacenamiento de enemigos en estructura de arrays (SoA): cada atributo es un
+// array contiguo y el enemigo i ocupa la posición i de todos ellos, así los
+// bucles de actualización, ataque y render recorren memoria de forma lineal.
+// Las bajas de cada tick se eliminan de una vez con removeMarked, que compacta
+// los arrays conservando el orden (el de creación, que decide a quién atacan
+// primero las torres); remove() mueve el último a la posición libre (swap-and-pop).
+class EnemyStore {
+public:
+    // Tamaño en píxeles de los enemigos
+    static const int ENEMY_SIZE = 40;
+
+    // Columnas (acceso directo para los bucles de EnemyManager)
+    std::vector<float> x, y;                  // Posición (derivada de distance; ver updatePositions)
+    std::vector<int> health;                  // Puntos de vida
+    std::vector<float> speed;                 // Píxeles por segundo
+    std::vector<float> resistance[DAMAGE_TYPE_COUNT];  // Resistencias por DamageType (0.0 - 1.0)
+    std::vector<int> pathId;                  // Camino que sigue (id en el PathRegistry)
+    std::vector<float> distance;              // Distancia recorrida en el camino (píxeles)
+    std::vector<int> segment;                 // Tramo del PathTrack en el que está
+    std::vector<int> pathIndex;               // Siguiente punto del camino (está entre pathIndex-1 y pathIndex)
+    std::vector<uint8_t> reachedEnd;          // Si ha llegado al final
+    std::vector<EnemyType> type;              // Tipo de enemigo
+    std::vector<int> goldValue;               // Oro al morir
+    std::vector<float> damageDealt;           // Daño total causado al jugador
+    std::vector<int> record;                  // Registro de rendimiento (-1 si no tiene)
+
+private:
+    // Tabla de handles: slot -> posición en los arrays
+    std::vector<uint32_t> slotToIndex;
+    std::vector<uint32_t> slotGeneration;
+    std::vector<uint32_t> freeSlots;
+    std::vector<uint32_t> indexToSlot;        // Columna: posición -> slot
+    
+    float lastStepSeconds = 0.0f;             // Duración del último paso de movimiento
+    bool positionsStale = false;              // x, y no corresponden a distance
+
+    void moveEnemy(size_t from, size_t to);
+    void resizeColumns(size_t count);
+    void releaseSlot(size_t i);
+
+public:
+    // Reserva sitio para 'capacity' enemigos: añadir hasta ese número no reserva memoria
+    void reserve(size_t capacity);
+    size_t capacity() const { return x.capacity(); }
+
+    // Añade un enemigo con los atributos base de su tipo y devuelve su posición.
+    // startDistance < 0 lo deja antes del inicio del camino
+    size_t add(EnemyType enemyType, int path, float startDistance = 0.0f);
+
+    // Elimina el enemigo de la posición i (el último pasa a ocupar i)
+    void remove(size_t i);
+
+    // Elimina los enemigos marcados (marked[i] != 0) sin alterar el orden del resto
+    void removeMarked(const std::vector<uint8_t>& marked);
+
+    // Elimina todos los enemigos (los handles existentes dejan de ser válidos)
+    void clear();
+
+    size_t size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+
+    // Handles generacionales (sirven de id del enemigo: no se repiten)
+    EnemyHandle getHandle(size_t i) const;
+    bool isValid(EnemyHandle handle) const;
+    int indexOf(EnemyHandle handle) const;    // -1 si ya no existe
+
+    // Estado
+    bool isAlive(size_t i) const { return health[i] > 0; }
+    const char* getTypeName(size_t i) const { return getEnemyArchetype(type[i]).name; }
+
+    // Pasa el enemigo i al inicio de otro camino
+    void setPath(size_t i, int path);
+
+    // Movimiento de todos los enemigos a lo largo de sus caminos: solo avanza la
+    // distancia recorrida (las posiciones se calculan al pedirlas)
+    void updateMovement(int deltaTime, const PathRegistry& paths);
+
+    // Recalcula las columnas x, y si los enemigos se han movido desde la última vez
+    void updatePositions(const PathRegistry& paths);
+
+    // Posición del enemigo i calculada al momento (sin tocar las columnas x, y)
+    void getPosition(size_t i, const PathRegistry& paths, float& outX, float& outY) const;
+
+    // Distancia máxima que avanzó el enemigo i en el último paso
+    float getStepDistance(size_t i) const { return speed[i] * lastStepSeconds; }
+
+    // Progreso en el camino (0.0 - 1.0): distancia recorrida / longitud del camino
+    float getPathProgress(size_t i, const PathRegistry& paths) const;
+
+    // Aplica daño de una torre teniendo en cuenta las resistencias; devuelve el daño real
+    int takeDamage(size_t i, int damage, TowerType towerType);
+};
+
+#endif // ENEMY_STORE_H
@@ -0,0 +1,49 @@
+#ifndef ENEMY_TYPES_H
+#define ENEMY_TYPES_H
+
+#include <cstdint>
+#include "CombatTypes.h"
+
+enum class EnemyType {
+    OGRE,
+    DARK_ELF,
+    HARPY,
+    MERCENARY
+};
+
+const int ENEMY_TYPE_COUNT = 4;
+
+// Atributos base de cada tipo de enemigo
+struct EnemyArchetype {
+    const char* name;          // Nombre para mostrar
+    int health;                // Puntos de vida
+    float speed;               // Velocidad (píxeles por segundo)
+    float resistances[DAMAGE_TYPE_COUNT];  // Por DamageType (0.0 = sin resistencia, 1.0 = inmune)
+    int goldValue;             // Oro al morir
+    uint8_t immunities;        // Tipos de daño que no le alcanzan (máscara de damageBit)
+};
+
+// Tabla indexada por EnemyType (mismo orden que Genome::enemyType)
+constexpr EnemyArchetype ENEMY_ARCHETYPES[ENEMY_TYPE_COUNT] = {
+    {"Ogro",        150, 20.0f, {0.7f, 0.2f, 0.3f}, 15, 0},  // Lento, mucha vida
+    {"Elfo Oscuro",  80, 60.0f, {0.2f, 0.7f, 0.3f}, 20, 0},  // Muy rápido, resistente a magia
+    {"Harpía",       70, 45.0f, {0.3f, 0.3f, 1.0f}, 25,      // Vuela: inmune a artillería
+     damageBit(DamageType::ARTILLERY)},
+    {"Mercenario",  100, 35.0f, {0.6f, 0.2f, 0.6f}, 30, 0}   // Resistente a flechas y artillería
+};
+
+constexpr const EnemyArchetype& getEnemyArchetype(EnemyType type) {
+    return ENEMY_ARCHETYPES[static_cast<int>(type)];
+}
+
+// Resistencia base de un tipo de enemigo a un tipo de daño
+constexpr float getBaseResistance(EnemyType enemy, DamageType damage) {
+    return getEnemyArchetype(enemy).resistances[static_cast<int>(damage)];
+}
+
+// Si un tipo de daño no puede alcanzar a un tipo de enemigo
+constexpr bool isImmune(EnemyType enemy, DamageType damage) {
+    return (getEnemyArchetype(enemy).immunities & damageBit(damage)) != 0;
+}
+
+#endif // ENEMY_TYPES_H
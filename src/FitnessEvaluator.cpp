@@ -0,0 +1,86 @@
+#include "FitnessEvaluator.h"
+#include "Simulation.h"
+#include "RandomStream.h"
+
+FitnessEvaluator::FitnessEvaluator(int threadCount, int maxSimulationMs, int tickMs)
+    : stopping(false), maxSimulationTime(maxSimulationMs), tickLength(tickMs) {
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) threadCount = 1;
+    }
+
+    // Crear los hilos trabajadores
+    for (int i = 0; i < threadCount; i++) {
+        workers.emplace_back(&FitnessEvaluator::workerLoop, this);
+    }
+}
+
+FitnessEvaluator::~FitnessEvaluator() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void FitnessEvaluator::workerLoop() {
+    while (true) {
+        std::function<void()> job;
+
+        // Esperar un trabajo (o la orden de terminar)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobAvailable.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (stopping && jobs.empty()) {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        job();
+    }
+}
+
+void FitnessEvaluator::evaluate(std::vector<Genome>& population, const GameBoard& board,
+                                const std::vector<TowerPlacement>& layout, uint64_t seed) {
+    // Trabajos pendientes de esta llamada (varias llamadas pueden compartir los hilos)
+    int pendingJobs = static_cast<int>(population.size());
+    int* pending = &pendingJobs;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Un trabajo por genoma: cada uno escribe solo en su propio elemento
+        for (size_t i = 0; i < population.size(); i++) {
+            Genome* genome = &population[i];
+            const GameBoard* boardPtr = &board;
+            const std::vector<TowerPlacement>* layoutPtr = &layout;
+
+            // Semilla propia por genoma para que el orden de los hilos no importe
+            uint64_t genomeSeed = RandomStream::forSubsystem(seed, RngStreamId::FITNESS_EVALUATION, i)();
+
+            jobs.push_back([this, genome, boardPtr, layoutPtr, genomeSeed, pending] {
+                Simulation simulation(*boardPtr, *layoutPtr, genomeSeed);
+                genome->fitness = simulation.evaluateGenome(*genome, maxSimulationTime, tickLength);
+
+                // Avisar a evaluate() cuando se termina el último trabajo
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    (*pending)--;
+                }
+                jobFinished.notify_all();
+            });
+        }
+    }
+    jobAvailable.notify_all();
+
+    // Esperar a que terminen todas las simulaciones
+    std::unique_lock<std::mutex> lock(mutex);
+    jobFinished.wait(lock, [pending] { return *pending == 0; });
+}
@@ -0,0 +1,51 @@
+#ifndef FITNESS_EVALUATOR_H
+#define FITNESS_EVALUATOR_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+#include "GameBoard.h"
+#include "TowerManager.h"
+#include "GeneticAlgorithm.h"
+
+// Evalúa el fitness de toda una población en paralelo. Cada genoma se simula
+// en una copia headless y aislada del tablero y de las torres actuales,
+// repartiendo el trabajo entre un grupo fijo de hilos.
+class FitnessEvaluator {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobFinished;
+    bool stopping;
+
+    // Configuración de cada simulación
+    int maxSimulationTime;   // Tiempo máximo simulado por genoma (ms)
+    int tickLength;          // Duración del tick de simulación (ms)
+
+    // Bucle de cada hilo trabajador
+    void workerLoop();
+
+public:
+    // threadCount <= 0 usa todos los núcleos disponibles
+    FitnessEvaluator(int threadCount = 0, int maxSimulationMs = 120000, int tickMs = 16);
+    ~FitnessEvaluator();
+
+    FitnessEvaluator(const FitnessEvaluator&) = delete;
+    FitnessEvaluator& operator=(const FitnessEvaluator&) = delete;
+
+    // Simula cada genoma y escribe su fitness. Bloquea hasta terminar.
+    // Se puede llamar desde varios hilos a la vez.
+    // El resultado depende solo de la semilla, no del reparto entre hilos.
+    void evaluate(std::vector<Genome>& population, const GameBoard& board,
+                  const std::vector<TowerPlacement>& layout, uint64_t seed);
+
+    int getThreadCount() const { return static_cast<int>(workers.size()); }
+};
+
+#endif // FITNESS_EVALUATOR_H
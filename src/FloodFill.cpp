@@ -0,0 +1,122 @@
+#include "FloodFill.h"
+
+namespace {
+// Extiende las celdas alcanzadas g hacia los bits altos (derecha en el tablero)
+// por los tramos de celdas caminables open; g debe estar dentro de open.
+// Relleno en 6 pasos que dobla la distancia en cada uno (Kogge-Stone)
+uint64_t fillTowardsHigh(uint64_t g, uint64_t open) {
+    g |= open & (g << 1);
+    open &= open << 1;
+    g |= open & (g << 2);
+    open &= open << 2;
+    g |= open & (g << 4);
+    open &= open << 4;
+    g |= open & (g << 8);
+    open &= open << 8;
+    g |= open & (g << 16);
+    open &= open << 16;
+    g |= open & (g << 32);
+    return g;
+}
+
+// Igual hacia los bits bajos (izquierda en el tablero)
+uint64_t fillTowardsLow(uint64_t g, uint64_t open) {
+    g |= open & (g >> 1);
+    open &= open >> 1;
+    g |= open & (g >> 2);
+    open &= open >> 2;
+    g |= open & (g >> 4);
+    open &= open >> 4;
+    g |= open & (g >> 8);
+    open &= open >> 8;
+    g |= open & (g >> 16);
+    open &= open >> 16;
+    g |= open & (g >> 32);
+    return g;
+}
+
+// Extiende lo alcanzado en una fila por sus tramos caminables: hacia la derecha
+// pasando el último bit de cada palabra a la siguiente, y después hacia la
+// izquierda al revés (un tramo puede cruzar varias palabras)
+void fillRow(uint64_t* row, const uint64_t* open, int wordsPerRow) {
+    uint64_t carry = 0;
+    for (int w = 0; w < wordsPerRow; w++) {
+        row[w] = fillTowardsHigh(row[w] | (carry & open[w]), open[w]);
+        carry = row[w] >> 63;
+    }
+    carry = 0;
+    for (int w = wordsPerRow - 1; w >= 0; w--) {
+        row[w] = fillTowardsLow(row[w] | ((carry << 63) & open[w]), open[w]);
+        carry = row[w] & 1;
+    }
+}
+}
+
+bool FloodFill::seedReached(const WalkableBitmap& walkable, SDL_Point seed, WalkableBitmap& reached) {
+    reached.reset(walkable.getRows(), walkable.getCols());
+    if (seed.x < 0 || seed.x >= walkable.getCols() || seed.y < 0 || seed.y >= walkable.getRows() ||
+        !walkable.isWalkable(seed.x, seed.y)) {
+        return false;
+    }
+    reached.set(seed.x, seed.y, true);
+    fillRow(reached.getRow(seed.y), walkable.getRow(seed.y), walkable.getWordsPerRow());
+    return true;
+}
+
+bool FloodFill::updateRow(const WalkableBitmap& walkable, WalkableBitmap& reached, int y) {
+    int wordsPerRow = walkable.getWordsPerRow();
+    const uint64_t* open = walkable.getRow(y);
+    const uint64_t* above = y > 0 ? reached.getRow(y - 1) : nullptr;
+    const uint64_t* below = y + 1 < walkable.getRows() ? reached.getRow(y + 1) : nullptr;
+    uint64_t* row = reached.getRow(y);
+
+    // Vecinos de arriba y de abajo: 64 celdas por operación
+    bool changed = false;
+    for (int w = 0; w < wordsPerRow; w++) {
+        uint64_t vertical = (above ? above[w] : 0) | (below ? below[w] : 0);
+        uint64_t updated = row[w] | (vertical & open[w]);
+        changed |= updated != row[w];
+        row[w] = updated;
+    }
+
+    // Solo hay que extender la fila si entró algo nuevo
+    if (changed) {
+        fillRow(row, open, wordsPerRow);
+    }
+    return changed;
+}
+
+bool FloodFill::sweep(const WalkableBitmap& walkable, WalkableBitmap& reached) {
+    bool changed = false;
+    int rows = walkable.getRows();
+    for (int y = 0; y < rows; y++) {
+        changed |= updateRow(walkable, reached, y);
+    }
+    for (int y = rows - 1; y >= 0; y--) {
+        changed |= updateRow(walkable, reached, y);
+    }
+    return changed;
+}
+
+void FloodFill::fill(const WalkableBitmap& walkable, SDL_Point seed, WalkableBitmap& reached) {
+    if (!seedReached(walkable, seed, reached)) {
+        return;
+    }
+    while (sweep(walkable, reached)) {
+    }
+}
+
+bool FloodFill::isConnected(const WalkableBitmap& walkable, SDL_Point from, SDL_Point to) {
+    if (to.x < 0 || to.x >= walkable.getCols() || to.y < 0 || to.y >= walkable.getRows()) {
+        return false;
+    }
+
+    // Memoria reutilizada entre llamadas del mismo hilo, como en AStar
+    thread_local WalkableBitmap reached;
+    if (!seedReached(walkable, from, reached)) {
+        return false;
+    }
+    while (!reached.isWalkable(to.x, to.y) && sweep(walkable, reached)) {
+    }
+    return reached.isWalkable(to.x, to.y);
+}
@@ -0,0 +1,34 @@
+#ifndef FLOOD_FILL_H
+#define FLOOD_FILL_H
+
+#include <SDL2/SDL.h>
+#include "WalkableBitmap.h"
+
+// Inundación por bits sobre un WalkableBitmap: en lugar de visitar celda a
+// celda con una cola, cada paso trata 64 celdas de una fila a la vez. Las filas
+// se recorren hacia abajo y hacia arriba; en cada una se añaden las celdas con
+// un vecino alcanzado en la fila anterior (un AND por palabra) y después se
+// extiende lo alcanzado a lo largo de cada tramo caminable con desplazamientos.
+// Se repite hasta que una pasada no añade nada. Vecindad 4, como AStar.
+class FloodFill {
+public:
+    // Celdas alcanzables desde seed (reached queda con las dimensiones de walkable;
+    // vacío si seed no es caminable o está fuera del mapa)
+    static void fill(const WalkableBitmap& walkable, SDL_Point seed, WalkableBitmap& reached);
+
+    // Indica si hay camino entre from y to (se para en cuanto alcanza to)
+    static bool isConnected(const WalkableBitmap& walkable, SDL_Point from, SDL_Point to);
+
+private:
+    // Una pasada hacia abajo y otra hacia arriba; devuelve si se alcanzó algo nuevo
+    static bool sweep(const WalkableBitmap& walkable, WalkableBitmap& reached);
+
+    // Añade a la fila y lo alcanzable desde sus vecinas y lo extiende por la fila
+    static bool updateRow(const WalkableBitmap& walkable, WalkableBitmap& reached, int y);
+
+    // Deja en reached solo la semilla extendida por su tramo de la fila; false
+    // si la semilla no es caminable o está fuera del mapa
+    static bool seedReached(const WalkableBitmap& walkable, SDL_Point seed, WalkableBitmap& reached);
+};
+
+#endif // FLOOD_FILL_H
@@ -0,0 +1,89 @@
+#include "FlowField.h"
+
+namespace {
+// Direcciones (arriba, derecha, abajo, izquierda), las mismas que usa A*
+const int DX[] = {0, 1, 0, -1};
+const int DY[] = {-1, 0, 1, 0};
+}
+
+FlowField::FlowField() : rows(0), cols(0), target{0, 0} {
+}
+
+void FlowField::compute(const WalkableBitmap& walkableMap, SDL_Point fieldTarget) {
+    rows = walkableMap.getRows();
+    cols = walkableMap.getCols();
+    target = fieldTarget;
+    distance.assign(rows * cols, UNREACHABLE);
+
+    if (target.x < 0 || target.x >= cols || target.y < 0 || target.y >= rows) {
+        return;
+    }
+
+    // BFS desde el destino: todas las aristas cuestan un paso
+    queue.resize(rows * cols);
+    size_t head = 0;
+    size_t tail = 0;
+    int targetIndex = target.y * cols + target.x;
+    distance[targetIndex] = 0;
+    queue[tail++] = targetIndex;
+
+    while (head < tail) {
+        int current = queue[head++];
+        int x = current % cols;
+        int y = current / cols;
+        int nextDistance = distance[current] + 1;
+
+        for (int i = 0; i < 4; i++) {
+            int nx = x + DX[i];
+            int ny = y + DY[i];
+            if (nx < 0 || nx >= cols || ny < 0 || ny >= rows) {
+                continue;
+            }
+
+            int neighbor = ny * cols + nx;
+            if (distance[neighbor] == UNREACHABLE && walkableMap.isWalkable(nx, ny)) {
+                distance[neighbor] = nextDistance;
+                queue[tail++] = neighbor;
+            }
+        }
+    }
+}
+
+int FlowField::getDistance(int x, int y) const {
+    if (x < 0 || x >= cols || y < 0 || y >= rows || distance.empty()) {
+        return UNREACHABLE;
+    }
+    return distance[y * cols + x];
+}
+
+bool FlowField::getNextCell(SDL_Point cell, SDL_Point& next) const {
+    int current = getDistance(cell.x, cell.y);
+    if (current == UNREACHABLE || current == 0) {
+        return false;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        int nx = cell.x + DX[i];
+        int ny = cell.y + DY[i];
+        if (getDistance(nx, ny) == current - 1) {
+            next = {nx, ny};
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FlowField::buildRoute(SDL_Point from, std::vector<SDL_Point>& route) const {
+    int steps = getDistance(from.x, from.y);
+    if (steps == UNREACHABLE) {
+        return false;
+    }
+
+    route.reserve(route.size() + steps + 1);
+    route.push_back(from);
+    SDL_Point cell = from;
+    while (getNextCell(cell, cell)) {
+        route.push_back(cell);
+    }
+    return true;
+}
@@ -0,0 +1,45 @@
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "WalkableBitmap.h"
+
+// Campo de distancias hasta un destino común (el puente): un BFS inverso desde
+// la salida por las celdas caminables. Todos los enemigos van al mismo sitio,
+// así que tras un cambio del tablero basta un cálculo del campo; cada enemigo
+// encuentra su siguiente celda mirando la distancia de sus vecinos.
+class FlowField {
+public:
+    static constexpr int UNREACHABLE = -1;
+
+private:
+    int rows;
+    int cols;
+    SDL_Point target;
+    std::vector<int> distance;   // Pasos hasta el destino (UNREACHABLE si no hay camino)
+    std::vector<int> queue;      // Cola del BFS (se reutiliza entre cálculos)
+
+public:
+    FlowField();
+
+    // Calcula las distancias sobre un mapa de celdas caminables (el de
+    // GameBoard::getWalkableMap()) hasta la celda target
+    void compute(const WalkableBitmap& walkableMap, SDL_Point target);
+
+    bool isComputed() const { return !distance.empty(); }
+
+    // Pasos desde la celda (x, y) hasta el destino (UNREACHABLE si no hay camino)
+    int getDistance(int x, int y) const;
+
+    // Vecino que acerca un paso al destino (en el orden de A*: arriba, derecha,
+    // abajo, izquierda); false si la celda es el destino o no llega a él
+    bool getNextCell(SDL_Point cell, SDL_Point& next) const;
+
+    // Celdas desde 'from' (incluida) hasta el destino; false si no llega
+    bool buildRoute(SDL_Point from, std::vector<SDL_Point>& route) const;
+};
+
+#endif // FLOW_FIELD_H
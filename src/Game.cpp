@@ -1,12 +1,16 @@
 #include "Game.h"
-#include <iostream>
+#include "Logger.h"
+#include "Profiler.h"
 #include <sstream>
 #include <iomanip>
+#include <cstdio>
 
 Game::Game() : window(nullptr), renderer(nullptr), running(false), 
-               board(nullptr), resources(nullptr), towerManager(nullptr),
-               enemyManager(nullptr), lastFrameTime(0), testMode(true),
-               font(nullptr) {
+               simulation(nullptr), board(nullptr), resources(nullptr), towerManager(nullptr),
+               enemyManager(nullptr), lastFrameTime(0),
+               tickLength(Simulation::DEFAULT_TICK_MS), maxCatchUpSteps(10),
+               speedMultiplier(1.0f), accumulator(0.0), seed(0), testMode(true),
+               font(nullptr), showProfiler(false) {
 }
 
 Game::~Game() {
@@ -16,27 +20,27 @@ Game::~Game() {
 bool Game::initialize() {
     // Inicializar SDL
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
-        std::cerr << "SDL no pudo inicializarse: " << SDL_GetError() << std::endl;
+        LOG_ERROR("SDL no pudo inicializarse: %s", SDL_GetError());
         return false;
     }
     
     // Inicializar SDL_image
     int imgFlags = IMG_INIT_PNG;
     if (!(IMG_Init(imgFlags) & imgFlags)) {
-        std::cerr << "SDL_image no pudo inicializarse: " << IMG_GetError() << std::endl;
+        LOG_ERROR("SDL_image no pudo inicializarse: %s", IMG_GetError());
         return false;
     }
     
     // Inicializar SDL_ttf
     if (TTF_Init() == -1) {
-        std::cerr << "SDL_ttf no pudo inicializarse: " << TTF_GetError() << std::endl;
+        LOG_ERROR("SDL_ttf no pudo inicializarse: %s", TTF_GetError());
         return false;
     }
     
     // Cargar fuente (asegúrate de que exista esta ruta)
     font = TTF_OpenFont("fonts/arial.ttf", 16);
     if (!font) {
-        std::cerr << "No se pudo cargar la fuente: " << TTF_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la fuente: %s", TTF_GetError());
         // Continuar sin fuente, mostraremos mensajes en consola
     }
     
@@ -49,28 +53,28 @@ bool Game::initialize() {
     );
     
     if (!window) {
-        std::cerr << "No se pudo crear la ventana: " << SDL_GetError() << std::endl;
+        LOG_ERROR("No se pudo crear la ventana: %s", SDL_GetError());
         return false;
     }
     
     // Crear renderer
     renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
     if (!renderer) {
-        std::cerr << "No se pudo crear el renderer: " << SDL_GetError() << std::endl;
+        LOG_ERROR("No se pudo crear el renderer: %s", SDL_GetError());
         return false;
     }
     
-    // Crear tablero (12x16 celdas)
-    board = new GameBoard(12, 16);
-    
-    // Crear sistema de recursos
-    resources = new ResourceSystem(100); // 100 de oro inicial
-    
-    // Crear gestor de torres
-    towerManager = new TowerManager(resources, renderer);
+    // Texto de la interfaz: atlas de glifos construido una vez con la fuente
+    if (font) {
+        textRenderer.initialize(renderer, font);
+    }
     
-    // Crear gestor de enemigos
-    enemyManager = new EnemyManager(board, resources, renderer);
+    // Crear la simulación: tablero de 12x16 celdas y 100 de oro inicial
+    simulation = new Simulation(renderer, 12, 16, 100, seed);
+    board = simulation->getBoard();
+    resources = simulation->getResources();
+    towerManager = simulation->getTowerManager();
+    enemyManager = simulation->getEnemyManager();
     
     // Inicializar tiempo
     lastFrameTime = SDL_GetTicks();
@@ -93,24 +97,27 @@ void Game::addAttackMessage(const std::string& text, const SDL_Color& color) {
     }
     
     // También mostrar en consola por si acaso
-    std::cout << text << std::endl;
+    LOG_DEBUG("%s", text.c_str());
+}
+
+void Game::setTimestep(int tickMs, int maxCatchUp) {
+    tickLength = tickMs > 0 ? tickMs : Simulation::DEFAULT_TICK_MS;
+    maxCatchUpSteps = maxCatchUp > 0 ? maxCatchUp : 1;
+}
+
+void Game::setProfileOutput(const std::string& path) {
+    traceFile = path;
+    showProfiler = true;
+    Profiler::instance().start();
 }
 
 void Game::update() {
-    // Calcular tiempo transcurrido desde el último frame
-    Uint32 currentTime = SDL_GetTicks();
-    int deltaTime = currentTime - lastFrameTime;
-    lastFrameTime = currentTime;
-    
-    // Actualizar torres
-    towerManager->update(deltaTime);
-    
-    // Actualizar enemigos
-    enemyManager->update(deltaTime);
+    // Cada llamada avanza exactamente un tick de simulación
+    int deltaTime = tickLength;
     
-    // Procesar ataques (pasar puntero a Game para los mensajes)
-    std::cout << "Checking tower attacks..." << std::endl;
-    enemyManager->processTowerAttacks(towerManager->getTowers(), this);
+    // Actualizar torres, enemigos y ataques (pasar puntero a Game para los mensajes)
+    LOG_DEBUG("Checking tower attacks...");
+    simulation->update(deltaTime, this);
     
     // Actualizar tiempo de vida de los mensajes
     for (auto it = attackMessages.begin(); it != attackMessages.end(); ) {
@@ -125,9 +132,8 @@ void Game::update() {
     // Debug: Print current game state
     static int frameCounter = 0;
     if (frameCounter++ % 60 == 0) {  // Print every 60 frames
-        std::cout << "Game State: " 
-                  << enemyManager->getEnemyCount() << " enemies active, "
-                  << "Player gold: " << resources->getGold() << std::endl;
+        LOG_DEBUG("Game State: %d enemies active, Player gold: %d",
+                  enemyManager->getEnemyCount(), resources->getGold());
     }
 }
 
@@ -138,16 +144,11 @@ void Game::renderAttackMessages() {
     int y = 50;  // Comenzar desde arriba
     
     for (const auto& msg : attackMessages) {
-        SDL_Surface* surface = TTF_RenderText_Blended(font, msg.text.c_str(), msg.color);
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect destRect = {SCREEN_WIDTH - surface->w - 10, y, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &destRect);
-                SDL_DestroyTexture(texture);
-                y += surface->h + 5;  // Espacio entre mensajes
-            }
-            SDL_FreeSurface(surface);
+        // Alineado a la derecha: hace falta el ancho antes de dibujar
+        SDL_Point size = textRenderer.measure(msg.text);
+        if (size.x > 0) {
+            textRenderer.draw(msg.text, SCREEN_WIDTH - size.x - 10, y, msg.color);
+            y += size.y + 5;  // Espacio entre mensajes
         }
     }
 }
@@ -172,6 +173,11 @@ void Game::render() {
     // Dibujar mensajes de ataque
     renderAttackMessages();
     
+    // Dibujar gráfica de tiempos por frame
+    if (showProfiler) {
+        renderProfilerOverlay();
+    }
+    
     // Actualizar pantalla
     SDL_RenderPresent(renderer);
 }
@@ -187,6 +193,15 @@ void Game::handleEvents() {
                 enemyManager->spawnTestEnemies();
             } else if (e.key.keysym.sym == SDLK_w && testMode) {
                 enemyManager->spawnWave();
+            } else if (e.key.keysym.sym == SDLK_f) {
+                // Mostrar u ocultar la gráfica (la primera vez empieza a medir)
+                showProfiler = !showProfiler;
+                if (showProfiler && !Profiler::isActive()) {
+                    Profiler::instance().start();
+                }
+            } else if (e.key.keysym.sym == SDLK_p && Profiler::isActive()) {
+                Profiler::instance().exportChromeTrace(
+                    traceFile.empty() ? "genetic_kingdom_trace.json" : traceFile.c_str());
             }
         } else if (e.type == SDL_MOUSEBUTTONDOWN) {
             if (e.button.button == SDL_BUTTON_LEFT) {
@@ -203,8 +218,7 @@ void Game::handleEvents() {
                 
                 // Comprobar si hay una torre en esa posición
                 if (towerManager->selectTowerAt(gridPos.y, gridPos.x)) {
-                    std::cout << "Torre seleccionada en (" 
-                              << gridPos.y << "," << gridPos.x << ")" << std::endl;
+                    LOG_INFO("Torre seleccionada en (%d,%d)", gridPos.y, gridPos.x);
                     continue;
                 }
                 
@@ -215,9 +229,8 @@ void Game::handleEvents() {
                     // Intentar crear torre
                     if (towerManager->createTower(gridPos.y, gridPos.x)) {
                         board->placeTower(gridPos.y, gridPos.x);
-                        std::cout << "Torre colocada en (" 
-                                  << gridPos.y << "," << gridPos.x 
-                                  << "). Oro restante: " << resources->getGold() << std::endl;
+                        LOG_INFO("Torre colocada en (%d,%d). Oro restante: %d",
+                                 gridPos.y, gridPos.x, resources->getGold());
                         
                         // MODIFICACIÓN PARA A*: Regenerar caminos cuando se coloca una torre
                         // Esto hace que los enemigos recalculen sus rutas cuando hay un nuevo obstáculo
@@ -230,17 +243,44 @@ void Game::handleEvents() {
 }
 
 void Game::run() {
+    lastFrameTime = SDL_GetTicks();
+    accumulator = 0.0;
+    
     while (running) {
+        PROFILE_BEGIN_FRAME();
         handleEvents();
-        update();
+        
+        // Acumular el tiempo real transcurrido (escalado por la velocidad)
+        Uint32 currentTime = SDL_GetTicks();
+        accumulator += (currentTime - lastFrameTime) * static_cast<double>(speedMultiplier);
+        lastFrameTime = currentTime;
+        
+        // Consumir el tiempo acumulado en ticks fijos
+        int steps = 0;
+        while (accumulator >= tickLength && steps < maxCatchUpSteps) {
+            update();
+            accumulator -= tickLength;
+            steps++;
+        }
+        
+        // Si no alcanzamos al reloj real, descartar el atraso en lugar de acumularlo
+        if (steps == maxCatchUpSteps && accumulator >= tickLength) {
+            accumulator = 0.0;
+        }
+        
         render();
         
+        // El frame medido no incluye la espera del control de FPS
+        PROFILE_END_FRAME();
+        
         // Control de FPS simple
         SDL_Delay(1000/60); // Aproximadamente 60 FPS
     }
 }
 
 void Game::renderUI() {
+    PROFILE_ZONE(ProfileZone::UI_RENDER);
+    
     // Dibujar rectángulo para info de recursos
     SDL_Rect goldRect = {SCREEN_WIDTH - 160, 10, 150, 30};
     SDL_SetRenderDrawColor(renderer, 50, 50, 50, 200);
@@ -249,19 +289,10 @@ void Game::renderUI() {
     // Si tenemos fuente, mostrar el oro en pantalla
     if (font) {
         std::string goldText = "Oro: " + std::to_string(resources->getGold());
-        SDL_Surface* surface = TTF_RenderText_Blended(font, goldText.c_str(), {255, 215, 0, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {SCREEN_WIDTH - 150, 15, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        renderText(goldText, SCREEN_WIDTH - 150, 15, {255, 215, 0, 255});
     } else {
         // Por ahora, solo imprimimos el oro en la consola
-        std::cout << "Oro: " << resources->getGold() << std::endl;
+        LOG_DEBUG("Oro: %d", resources->getGold());
     }
     
     // Información sobre oleadas (para la fase 3)
@@ -272,23 +303,14 @@ void Game::renderUI() {
     // Mostrar información sobre oleadas si tenemos fuente
     if (font) {
         std::string waveText = "Oleada: " + std::to_string(enemyManager->getCurrentWave());
-        SDL_Surface* surface = TTF_RenderText_Blended(font, waveText.c_str(), {255, 255, 255, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {SCREEN_WIDTH - 150, 55, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        renderText(waveText, SCREEN_WIDTH - 150, 55, {255, 255, 255, 255});
     }
     
     // Mostrar instrucciones de prueba
     if (testMode) {
-        std::cout << "ESPACIO: generar enemigos de prueba | W: generar oleada" << std::endl;
-        std::cout << "Oleada actual: " << enemyManager->getCurrentWave() << std::endl;
-        std::cout << "Enemigos activos: " << enemyManager->getEnemyCount() << std::endl;
+        LOG_DEBUG("ESPACIO: generar enemigos de prueba | W: generar oleada");
+        LOG_DEBUG("Oleada actual: %d", enemyManager->getCurrentWave());
+        LOG_DEBUG("Enemigos activos: %d", enemyManager->getEnemyCount());
     }
     
     // Mostrar estadísticas genéticas
@@ -302,30 +324,12 @@ void Game::renderUI() {
         
         // Línea 1: Generación actual
         std::string genText = "Generacion: " + std::to_string(enemyManager->getCurrentGeneration());
-        SDL_Surface* surface = TTF_RenderText_Blended(font, genText.c_str(), {255, 255, 255, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {15, textY, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        renderText(genText, 15, textY, {255, 255, 255, 255});
         textY += lineHeight;
         
         // Línea 2: Oleada actual
         std::string waveText = "Oleada: " + std::to_string(enemyManager->getCurrentWave());
-        surface = TTF_RenderText_Blended(font, waveText.c_str(), {255, 255, 255, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {15, textY, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        renderText(waveText, 15, textY, {255, 255, 255, 255});
         textY += lineHeight;
         
         // Línea 3: Fitness - VERSIÓN CORREGIDA
@@ -339,56 +343,109 @@ void Game::renderUI() {
                 avgFitness, bestFitness, worstFitness);
         std::string fitnessText = fitnessBuffer;
         
-        surface = TTF_RenderText_Blended(font, fitnessText.c_str(), {255, 255, 255, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {15, textY, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        renderText(fitnessText, 15, textY, {255, 255, 255, 255});
         textY += lineHeight;
         
         // Línea 4: Mutaciones
         std::string mutText = "Tasa de mutacion: " + std::to_string(enemyManager->getMutationRate()).substr(0, 4) + 
                               " Mutaciones: " + std::to_string(enemyManager->getMutationsOccurred());
-        surface = TTF_RenderText_Blended(font, mutText.c_str(), {255, 255, 255, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {15, textY, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        renderText(mutText, 15, textY, {255, 255, 255, 255});
         textY += lineHeight;
         
         // Línea 5: Enemigos activos
         std::string enemyText = "Enemigos activos: " + std::to_string(enemyManager->getEnemyCount());
-        surface = TTF_RenderText_Blended(font, enemyText.c_str(), {255, 255, 255, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {15, textY, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
+        renderText(enemyText, 15, textY, {255, 255, 255, 255});
+    }
+}
+
+void Game::renderText(const std::string& text, int x, int y, const SDL_Color& color) {
+    if (!font) return;
+    
+    // Atlas de glifos o textura en caché: sin superficies nuevas en cada frame
+    textRenderer.draw(text, x, y, color);
+}
+
+void Game::renderProfilerOverlay() {
+    Profiler& profiler = Profiler::instance();
+    size_t frameCount = profiler.getFrameCount();
+    if (frameCount == 0) return;
+    
+    // Panel: una barra por frame (el más reciente a la derecha); la línea marca 16.7 ms
+    const int barCount = 180;
+    const int panelWidth = barCount * 2 + 10;
+    const int graphHeight = 60;
+    const double msPerPixel = 33.3 / graphHeight;
+    SDL_Rect panel = {10, 10, panelWidth, graphHeight + 50};
+    
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &panel);
+    
+    int graphBottom = panel.y + panel.h - 5;
+    size_t shown = frameCount < static_cast<size_t>(barCount) ? frameCount : barCount;
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+    for (size_t age = 0; age < shown; age++) {
+        const Profiler::FrameRecord& frame = profiler.getFrame(age);
+        double ms = frame.durationNs / 1e6;
+        totalMs += ms;
+        if (ms > maxMs) maxMs = ms;
+        
+        int height = static_cast<int>(ms / msPerPixel);
+        if (height > graphHeight) height = graphHeight;
+        if (height < 1) height = 1;
+        
+        // Verde dentro de presupuesto, amarillo hasta 33 ms, rojo por encima
+        if (ms <= 16.7) {
+            SDL_SetRenderDrawColor(renderer, 80, 220, 80, 255);
+        } else if (ms <= 33.3) {
+            SDL_SetRenderDrawColor(renderer, 230, 200, 60, 255);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 230, 70, 70, 255);
         }
+        SDL_Rect bar = {panel.x + panelWidth - 7 - static_cast<int>(age) * 2, graphBottom - height, 2, height};
+        SDL_RenderFillRect(renderer, &bar);
     }
+    
+    int budgetY = graphBottom - static_cast<int>(16.7 / msPerPixel);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 120);
+    SDL_RenderDrawLine(renderer, panel.x + 3, budgetY, panel.x + panelWidth - 3, budgetY);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    
+    // Texto: resumen del historial y reparto del último frame
+    const Profiler::FrameRecord& last = profiler.getFrame(0);
+    auto zoneMs = [&last](ProfileZone zone) { return last.zoneNs[static_cast<int>(zone)] / 1e6; };
+    
+    char line[128];
+    std::snprintf(line, sizeof(line), "Frame: %.2f ms  Prom: %.2f  Max: %.2f",
+                  last.durationNs / 1e6, totalMs / shown, maxMs);
+    renderText(line, panel.x + 5, panel.y + 3, {255, 255, 255, 255});
+    
+    std::snprintf(line, sizeof(line), "Upd %.2f/%.2f/%.2f  Rend %.2f/%.2f/%.2f/%.2f",
+                  zoneMs(ProfileZone::TOWER_UPDATE), zoneMs(ProfileZone::ENEMY_UPDATE),
+                  zoneMs(ProfileZone::TOWER_ATTACKS), zoneMs(ProfileZone::BOARD_RENDER),
+                  zoneMs(ProfileZone::TOWER_RENDER), zoneMs(ProfileZone::ENEMY_RENDER),
+                  zoneMs(ProfileZone::UI_RENDER));
+    renderText(line, panel.x + 5, panel.y + 21, {200, 200, 200, 255});
 }
 
 void Game::clean() {
-    // Liberar recursos
-    delete board;
-    delete resources;
-    delete towerManager;
-    delete enemyManager;
+    // Escribir la traza pedida con --profile
+    if (!traceFile.empty() && Profiler::isActive()) {
+        Profiler::instance().exportChromeTrace(traceFile.c_str());
+        Profiler::instance().stop();
+    }
+    
+    // Liberar recursos (la simulación libera tablero, recursos y gestores)
+    delete simulation;
+    simulation = nullptr;
+    board = nullptr;
+    resources = nullptr;
+    towerManager = nullptr;
+    enemyManager = nullptr;
     
-    // Liberar recursos de texto
+    // Liberar recursos de texto (las texturas del texto antes que la fuente y el renderer)
+    textRenderer.clear();
     if (font) TTF_CloseFont(font);
     TTF_Quit();
     
@@ -11,6 +11,8 @@
 #include "ResourceSystem.h"
 #include "TowerManager.h"
 #include "EnemyManager.h"
+#include "Simulation.h"
+#include "TextRenderer.h"
 
 // Estructura para almacenar mensajes de ataque
 struct AttackMessage {
@@ -25,6 +27,10 @@ private:
     SDL_Renderer* renderer;
     bool running;
     
+    // Lógica del juego (independiente de la ventana)
+    Simulation* simulation;
+    
+    // Accesos directos a los subsistemas (propiedad de simulation)
     GameBoard* board;
     ResourceSystem* resources;
     TowerManager* towerManager;
@@ -32,12 +38,23 @@ private:
     
     // Para renderizar texto
     TTF_Font* font;
+    TextRenderer textRenderer;  // Atlas de glifos y caché de textos
     std::deque<AttackMessage> attackMessages;  // Lista de mensajes recientes
     const int MAX_MESSAGES = 5;  // Número máximo de mensajes mostrados
     
     // Tiempo para control de FPS y actualización
     Uint32 lastFrameTime;
     
+    // Paso fijo de simulación: el tiempo real se acumula y se consume en ticks
+    // de duración constante, así la lógica no depende de la duración del frame
+    int tickLength;          // Duración de cada tick (ms de simulación)
+    int maxCatchUpSteps;     // Máximo de ticks por frame (evita la espiral de la muerte)
+    float speedMultiplier;   // Velocidad de la simulación respecto al tiempo real
+    double accumulator;      // Tiempo pendiente de simular (ms)
+    
+    // Semilla de la sesión (permite repetir la partida)
+    uint64_t seed;
+    
     // Constantes del juego
     const int SCREEN_WIDTH = 800;
     const int SCREEN_HEIGHT = 600;
@@ -52,6 +69,16 @@ private:
     // Modo de test (para generar enemigos manualmente)
     bool testMode;
     
+    // Perfilado: gráfica de tiempos por frame (tecla F) y archivo de la traza (tecla P)
+    bool showProfiler;
+    std::string traceFile;
+    
+    // Método para renderizar la gráfica de tiempos por frame
+    void renderProfilerOverlay();
+    
+    // Método para renderizar una línea de texto
+    void renderText(const std::string& text, int x, int y, const SDL_Color& color);
+    
 public:
     Game();
     ~Game();
@@ -65,9 +92,21 @@ public:
     // Maneja eventos
     void handleEvents();
     
-    // Actualiza el estado del juego
+    // Actualiza el estado del juego un tick fijo
     void update();
     
+    // Configura el paso fijo (duración del tick y ticks máximos por frame)
+    void setTimestep(int tickMs, int maxCatchUp);
+    
+    // Configura la semilla de la sesión (antes de initialize)
+    void setSeed(uint64_t sessionSeed) { seed = sessionSeed; }
+    
+    // Configura la velocidad de la simulación (1.0 = tiempo real)
+    void setSpeedMultiplier(float multiplier) { speedMultiplier = multiplier; }
+    
+    // Activa el perfilado desde el inicio; la traza se escribe en el archivo al salir
+    void setProfileOutput(const std::string& path);
+    
     // Renderiza todo
     void render();
     
@@ -1,11 +1,13 @@
 #include "GameBoard.h"
-#include <iostream>
+#include "Profiler.h"
+#include "FloodFill.h"
+#include <algorithm>
 
 const int GRID_SIZE = 50; // Tamaño de cada celda
 
-GameBoard::GameBoard(int r, int c) : rows(r), cols(c) {
+GameBoard::GameBoard(int r, int c) : rows(r), cols(c), walkableVersion(0), entranceConnected(false) {
     // Inicializar el tablero con celdas vacías
-    grid.resize(rows, std::vector<int>(cols, 0));
+    grid.assign(rows * cols, 0);
     
     // Definir entrada y salida
     entrance = {0, r/2};
@@ -19,97 +21,163 @@ void GameBoard::initializeMap() {
     // Limpiamos el grid (excepto las torres)
     for (int r = 0; r < rows; r++) {
         for (int c = 0; c < cols; c++) {
-            if (grid[r][c] != 2) { // No tocar las torres existentes
-                grid[r][c] = 0;
+            if (grid[r * cols + c] != 2) { // No tocar las torres existentes
+                grid[r * cols + c] = 0;
             }
         }
     }
     
     // Camino principal en medio (como antes)
     for (int c = 0; c < cols; c++) {
-        grid[rows/2][c] = 1;
+        grid[(rows/2) * cols + c] = 1;
     }
     
     // Camino alternativo por arriba
     if (rows > 4) {
         for (int c = 0; c < cols/2; c++) {
-            grid[rows/4][c] = 1;
+            grid[(rows/4) * cols + c] = 1;
         }
         // Conectar con el camino principal
         for (int r = rows/4; r <= rows/2; r++) {
-            grid[r][cols/2-1] = 1;
+            grid[r * cols + cols/2 - 1] = 1;
         }
     }
     
     // Camino alternativo por abajo
     if (rows > 5) {
         for (int c = cols/2; c < cols; c++) {
-            grid[3*rows/4][c] = 1;
+            grid[(3*rows/4) * cols + c] = 1;
         }
         // Conectar con el camino principal
         for (int r = rows/2; r <= 3*rows/4; r++) {
-            grid[r][cols/2] = 1;
+            grid[r * cols + cols/2] = 1;
         }
     }
     
     // Marcar entrada y salida
-    grid[entrance.y][entrance.x] = 1;
-    grid[exit.y][exit.x] = 1;
+    grid[entrance.y * cols + entrance.x] = 1;
+    grid[exit.y * cols + exit.x] = 1;
+    
+    updateWalkableMap();
 }
 
-bool GameBoard::hasValidPath() const {
-    return findPath(entrance, exit);
+void GameBoard::updateWalkableMap() {
+    walkableMap.reset(rows, cols);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            walkableMap.set(c, r, isCellWalkable(c, r));
+        }
+    }
+    walkableVersion++;
+    updatePlacementMask();
 }
 
-bool GameBoard::findPath(SDL_Point start, SDL_Point end) const {
-    // Implementación de BFS para encontrar camino
-    std::vector<std::vector<bool>> visited(rows, std::vector<bool>(cols, false));
-    std::queue<SDL_Point> queue;
-    
-    // Agregar punto de inicio
-    queue.push(start);
-    visited[start.y][start.x] = true;
-    
+void GameBoard::updatePlacementMask() {
+    int cellCount = rows * cols;
+    cutCells.assign(cellCount, 0);
+    placementMask.assign(cellCount, 0);
+
+    // Sin camino de entrada a salida no hay celdas de corte ni posiciones
+    // válidas (la inundación por bits lo descarta sin el DFS)
+    entranceConnected = FloodFill::isConnected(walkableMap, entrance, exit);
+    if (!entranceConnected) {
+        return;
+    }
+
+    // DFS iterativo (Tarjan) desde la entrada por las celdas caminables:
+    // order = orden de descubrimiento, low = menor orden alcanzable desde el
+    // subárbol con una arista de retroceso, reachesExit = el subárbol contiene la salida
+    std::vector<int>& order = dfs.order;
+    std::vector<int>& low = dfs.low;
+    std::vector<int>& parent = dfs.parent;
+    std::vector<uint8_t>& nextDirection = dfs.nextDirection;
+    std::vector<uint8_t>& reachesExit = dfs.reachesExit;
+    std::vector<int>& stack = dfs.stack;
+    order.assign(cellCount, -1);
+    low.assign(cellCount, 0);
+    parent.assign(cellCount, -1);
+    nextDirection.assign(cellCount, 0);
+    reachesExit.assign(cellCount, 0);
+    stack.clear();
+    stack.reserve(cellCount);
+
     // Movimientos posibles (arriba, derecha, abajo, izquierda)
     const int dr[] = {-1, 0, 1, 0};
     const int dc[] = {0, 1, 0, -1};
-    
-    while (!queue.empty()) {
-        SDL_Point current = queue.front();
-        queue.pop();
-        
-        // Si llegamos al final, hay un camino
-        if (current.x == end.x && current.y == end.y) {
-            return true;
+
+    int entranceIndex = entrance.y * cols + entrance.x;
+    int exitIndex = exit.y * cols + exit.x;
+    int counter = 0;
+    order[entranceIndex] = low[entranceIndex] = counter++;
+    stack.push_back(entranceIndex);
+
+    while (!stack.empty()) {
+        int cell = stack.back();
+        int r = cell / cols;
+        int c = cell % cols;
+
+        if (nextDirection[cell] < 4) {
+            int dir = nextDirection[cell]++;
+            int newR = r + dr[dir];
+            int newC = c + dc[dir];
+            if (newR < 0 || newR >= rows || newC < 0 || newC >= cols) {
+                continue;
+            }
+            if (!walkableMap.isWalkable(newC, newR)) {
+                continue;
+            }
+            int neighbor = newR * cols + newC;
+            if (order[neighbor] == -1) {
+                parent[neighbor] = cell;
+                order[neighbor] = low[neighbor] = counter++;
+                stack.push_back(neighbor);
+            } else if (neighbor != parent[cell]) {
+                low[cell] = std::min(low[cell], order[neighbor]);
+            }
+            continue;
         }
-        
-        // Verificar vecinos
-        for (int i = 0; i < 4; i++) {
-            int newR = current.y + dr[i];
-            int newC = current.x + dc[i];
-            
-            // Comprobar límites y si es un camino no visitado
-            if (newR >= 0 && newR < rows && newC >= 0 && newC < cols && 
-                grid[newR][newC] == 1 && !visited[newR][newC]) {
-                SDL_Point next = {newC, newR};
-                queue.push(next);
-                visited[newR][newC] = true;
+
+        // Celda terminada: se propaga al padre
+        stack.pop_back();
+        if (cell == exitIndex) {
+            reachesExit[cell] = 1;
+        }
+        int up = parent[cell];
+        if (up != -1) {
+            low[up] = std::min(low[up], low[cell]);
+            if (reachesExit[cell]) {
+                reachesExit[up] = 1;
+                // Sin otra salida por encima de 'up', todo camino a la salida pasa por él
+                if (low[cell] >= order[up]) {
+                    cutCells[up] = 1;
+                }
             }
         }
     }
-    
-    // No se encontró camino
-    return false;
+
+    cutCells[entranceIndex] = 1;
+    cutCells[exitIndex] = 1;
+
+    // Una torre es válida en una celda vacía si tras ponerla sigue habiendo
+    // camino: es decir, si la celda no es de corte
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int index = r * cols + c;
+            placementMask[index] = (grid[index] == 0 && !cutCells[index]) ? 1 : 0;
+        }
+    }
 }
 
 void GameBoard::render(SDL_Renderer* renderer) const {
+    PROFILE_ZONE(ProfileZone::BOARD_RENDER);
+    
     // Dibujar el tablero
     for (int r = 0; r < rows; r++) {
         for (int c = 0; c < cols; c++) {
             SDL_Rect cell = {c * GRID_SIZE, r * GRID_SIZE, GRID_SIZE, GRID_SIZE};
             
             // Colorear según el tipo de celda
-            switch (grid[r][c]) {
+            switch (grid[r * cols + c]) {
                 case 0: // Celda vacía - verde claro
                     SDL_SetRenderDrawColor(renderer, 144, 238, 144, 255);
                     break;
@@ -146,26 +214,23 @@ bool GameBoard::isValidTowerPosition(int r, int c) const {
         return false;
     }
     
-    // No permitir colocar torres en caminos
-    if (grid[r][c] != 0) {
-        return false;
-    }
-    
-    // Simular colocación para verificar si bloquearía todos los caminos
-    std::vector<std::vector<int>> tempGrid = grid;
-    tempGrid[r][c] = 2; // Colocar torre temporalmente
-    
-    // Crear tablero temporal para verificar camino
-    GameBoard tempBoard = *this;
-    tempBoard.grid = tempGrid;
-    
-    // Verificar si hay un camino válido después de colocar la torre
-    return tempBoard.hasValidPath();
+    // Celda vacía que no corta el camino de entrada a salida (precalculado)
+    return placementMask[r * cols + c] != 0;
 }
 
 bool GameBoard::placeTower(int r, int c) {
     if (isValidTowerPosition(r, c)) {
-        grid[r][c] = 2;
+        grid[r * cols + c] = 2;
+        bool walkable = isCellWalkable(c, r);
+        if (walkableMap.isWalkable(c, r) != walkable) {
+            walkableMap.set(c, r, walkable);
+            walkableVersion++;
+            updatePlacementMask();
+        } else {
+            // Las torres van en celdas vacías, que no son caminables: los
+            // caminos y las celdas de corte no cambian, solo se ocupa la celda
+            placementMask[r * cols + c] = 0;
+        }
         return true;
     }
     return false;
@@ -175,9 +240,20 @@ SDL_Point GameBoard::screenToGrid(int x, int y) const {
     return {x / GRID_SIZE, y / GRID_SIZE};
 }
 
+bool GameBoard::isCutCell(int r, int c) const {
+    if (r >= 0 && r < rows && c >= 0 && c < cols) {
+        return cutCells[r * cols + c] != 0;
+    }
+    return false;
+}
+
+bool GameBoard::isReachable(SDL_Point from, SDL_Point to) const {
+    return FloodFill::isConnected(walkableMap, from, to);
+}
+
 int GameBoard::getCellType(int r, int c) const {
     if (r >= 0 && r < rows && c >= 0 && c < cols) {
-        return grid[r][c];
+        return grid[r * cols + c];
     }
     return -1; // Fuera de límites
 }
@@ -189,7 +265,7 @@ bool GameBoard::isCellWalkable(int x, int y) const {
     }
     
     // Celda es caminable si es un camino (1) o entrada/salida
-    return grid[y][x] == 1 || 
+    return grid[y * cols + x] == 1 || 
            (x == entrance.x && y == entrance.y) || 
            (x == exit.x && y == exit.y);
 }
\ No newline at end of file
@@ -3,24 +3,52 @@
 
 #include <SDL2/SDL.h>
 #include <vector>
-#include <queue>
+#include <cstdint>
 #include <utility>
+#include "WalkableBitmap.h"
 
 class GameBoard {
 private:
     int rows;
     int cols;
-    std::vector<std::vector<int>> grid; // 0 = vacío, 1 = camino, 2 = torre
+    std::vector<uint8_t> grid; // Fila a fila (r * cols + c): 0 = vacío, 1 = camino, 2 = torre
     
     // Posiciones de entrada y salida (puente)
     SDL_Point entrance;
     SDL_Point exit;
     
-    // Verifica si hay al menos un camino disponible de entrada a salida
-    bool hasValidPath() const;
+    // Celdas caminables (un bit por celda) para los buscadores de caminos
+    WalkableBitmap walkableMap;
+    uint32_t walkableVersion;  // Aumenta cada vez que cambia walkableMap
+    
+    // Celdas de corte: caminables cuya eliminación separa la entrada de la salida
+    // (puntos de articulación en el grafo de celdas caminables). Con ellas y
+    // placementMask la validez de una torre es una consulta, sin copiar el tablero
+    std::vector<uint8_t> cutCells;
+    std::vector<uint8_t> placementMask;  // 1 = se puede colocar una torre
+    bool entranceConnected;              // Hay camino de entrada a salida
     
-    // Método para encontrar camino usando BFS (Breadth-First Search)
-    bool findPath(SDL_Point start, SDL_Point end) const;
+    // Memoria del DFS de updatePlacementMask, reutilizada entre llamadas. No
+    // es estado del tablero: las copias (instantáneas de Simulation) no la heredan
+    struct DfsScratch {
+        std::vector<int> order;
+        std::vector<int> low;
+        std::vector<int> parent;
+        std::vector<uint8_t> nextDirection;
+        std::vector<uint8_t> reachesExit;
+        std::vector<int> stack;
+
+        DfsScratch() {}
+        DfsScratch(const DfsScratch&) {}
+        DfsScratch& operator=(const DfsScratch&) { return *this; }
+    };
+    DfsScratch dfs;
+    
+    // Recalcula walkableMap a partir del grid
+    void updateWalkableMap();
+    
+    // Recalcula cutCells y placementMask (tras cada cambio de walkableMap)
+    void updatePlacementMask();
 
 public:
     GameBoard(int r, int c);
@@ -34,6 +62,20 @@ public:
     // Verifica si es válido colocar una torre en (r, c)
     bool isValidTowerPosition(int r, int c) const;
     
+    // Mapa de posiciones válidas para torres (índice r * cols + c, 1 = válida),
+    // para consultar el tablero entero de una vez
+    const std::vector<uint8_t>& getValidPlacementMask() const { return placementMask; }
+    
+    // Verifica si hay al menos un camino disponible de entrada a salida
+    bool hasValidPath() const { return entranceConnected; }
+    
+    // Verifica si se puede ir caminando de la celda from a la celda to
+    // (inundación por bits sobre el mapa de celdas caminables)
+    bool isReachable(SDL_Point from, SDL_Point to) const;
+    
+    // Verifica si (r, c) es una celda de corte del camino de entrada a salida
+    bool isCutCell(int r, int c) const;
+    
     // Coloca una torre en (r, c) si es válido
     bool placeTower(int r, int c);
     
@@ -52,6 +94,15 @@ public:
 
     // Verifica si una celda es caminable (camino o entrada/salida)
     bool isCellWalkable(int x, int y) const;
+    
+    // Celdas del tablero fila a fila (r * cols + c), con los mismos valores que getCellType
+    const std::vector<uint8_t>& getCells() const { return grid; }
+    
+    // Mapa de celdas caminables (igual que isCellWalkable)
+    const WalkableBitmap& getWalkableMap() const { return walkableMap; }
+    
+    // Versión del mapa de celdas caminables (si no cambia, los caminos siguen valiendo)
+    uint32_t getWalkableVersion() const { return walkableVersion; }
 };
 
 #endif // GAMEBOARD_H
\ No newline at end of file
@@ -1,18 +1,16 @@
 #include "GeneticAlgorithm.h"
 #include <numeric>
 #include <algorithm>
+#include "Logger.h"
 
 GeneticAlgorithm::GeneticAlgorithm(int popSize, float mutRate, 
-                                 float crossRate, int elite)
-    : populationSize(popSize), mutationRate(mutRate), 
+                                 float crossRate, int elite, uint64_t seed)
+    : rng(RandomStream::forSubsystem(seed, RngStreamId::GENETIC_ALGORITHM)),
+      populationSize(popSize), mutationRate(mutRate), 
       crossoverRate(crossRate), eliteCount(elite),
       currentGeneration(0), mutationsOccurred(0),
       averageFitness(0.0f), bestFitness(0.0f), worstFitness(0.0f) {
     
-    // Inicializar el generador de números aleatorios
-    std::random_device rd;
-    rng = std::mt19937(rd());
-    
     // Definir límites para los atributos
     limits.minHealth = 50.0f;
     limits.maxHealth = 200.0f;
@@ -38,69 +36,50 @@ void GeneticAlgorithm::initializePopulation() {
     currentGeneration = 1;
     mutationsOccurred = 0;
     
-    std::cout << "Población inicial creada con " << populationSize << " individuos" << std::endl;
+    LOG_DEBUG("Población inicial creada con %d individuos", populationSize);
 }
 
 void GeneticAlgorithm::initializeGenome(Genome& genome, int enemyType) {
     genome.enemyType = enemyType;
     
-    // Inicializar atributos según el tipo de enemigo
-    switch (enemyType) {
-        case 0: // Ogro
-            genome.health = 150.0f;
-            genome.speed = 20.0f;
-            genome.arrowResistance = 0.7f;
-            genome.magicResistance = 0.2f;
-            genome.artilleryResistance = 0.3f;
-            break;
-        case 1: // Elfo Oscuro
-            genome.health = 80.0f;
-            genome.speed = 60.0f;
-            genome.arrowResistance = 0.2f;
-            genome.magicResistance = 0.7f;
-            genome.artilleryResistance = 0.3f;
-            break;
-        case 2: // Harpía
-            genome.health = 70.0f;
-            genome.speed = 45.0f;
-            genome.arrowResistance = 0.3f;
-            genome.magicResistance = 0.3f;
-            genome.artilleryResistance = 1.0f;
-            break;
-        case 3: // Mercenario
-            genome.health = 100.0f;
-            genome.speed = 35.0f;
-            genome.arrowResistance = 0.6f;
-            genome.magicResistance = 0.2f;
-            genome.artilleryResistance = 0.6f;
-            break;
+    // Inicializar atributos con los valores base del tipo de enemigo
+    if (enemyType >= 0 && enemyType < ENEMY_TYPE_COUNT) {
+        const EnemyArchetype& archetype = ENEMY_ARCHETYPES[enemyType];
+        genome.health = static_cast<float>(archetype.health);
+        genome.speed = archetype.speed;
+        genome.arrowResistance = archetype.resistances[static_cast<int>(DamageType::ARROW)];
+        genome.magicResistance = archetype.resistances[static_cast<int>(DamageType::MAGIC)];
+        genome.artilleryResistance = archetype.resistances[static_cast<int>(DamageType::ARTILLERY)];
     }
     
     // Fitness inicial a 0
     genome.fitness = 0.0f;
 }
 
+float GeneticAlgorithm::calculateFitness(float progressMade, float damageDealt, float timeAlive) {
+    float fitness = progressMade * 10.0f + (damageDealt / 100.0f) + (timeAlive / 1000.0f);
+    
+    // Asegurar que el fitness nunca sea negativo
+    return std::max(0.0f, fitness);
+}
+
 void GeneticAlgorithm::updateFitness(Genome& genome, float progressMade, float damageDealt, float timeAlive) {
     // Imprimir valores de entrada para depuración
-    std::cout << "DEBUG - UpdateFitness con valores: progreso=" << progressMade 
-              << ", daño=" << damageDealt 
-              << ", tiempo=" << timeAlive << std::endl;
+    LOG_DEBUG("DEBUG - UpdateFitness con valores: progreso=%g, daño=%g, tiempo=%g",
+              progressMade, damageDealt, timeAlive);
     
     // Verifica que al menos uno de los valores no sea cero para asegurar cálculo de fitness
     if (progressMade <= 0.0f && damageDealt <= 0.0f && timeAlive <= 0.0f) {
-        std::cout << "ADVERTENCIA: Todos los valores de fitness son 0 o negativos!" << std::endl;
+        LOG_WARN("ADVERTENCIA: Todos los valores de fitness son 0 o negativos!");
     }
     
-    // Ejemplo de cálculo de fitness: priorizar el progreso hacia el puente
-    float fitness = progressMade * 10.0f + (damageDealt / 100.0f) + (timeAlive / 1000.0f);
-    
-    // Asegurar que el fitness nunca sea negativo
-    fitness = std::max(0.0f, fitness);
+    // Calcular fitness (nunca negativo)
+    float fitness = calculateFitness(progressMade, damageDealt, timeAlive);
     
     // Almacenar el nuevo fitness
     genome.fitness = fitness;
     
-    std::cout << "Fitness actualizado: " << fitness << std::endl;
+    LOG_DEBUG("Fitness actualizado: %g", fitness);
 }
 
 void GeneticAlgorithm::evolve() {
@@ -110,8 +89,8 @@ void GeneticAlgorithm::evolve() {
     
     // 1. Calcular estadísticas antes de evolucionar
     updateStatistics();
-    std::cout << "DEBUG - Antes de evolución: Fitness Prom=" << averageFitness 
-              << ", Mejor=" << bestFitness << ", Peor=" << worstFitness << std::endl;
+    LOG_DEBUG("DEBUG - Antes de evolución: Fitness Prom=%g, Mejor=%g, Peor=%g",
+              averageFitness, bestFitness, worstFitness);
     
     // 2. Ordenar la población por fitness (de mayor a menor)
     std::sort(population.begin(), population.end(), 
@@ -145,27 +124,52 @@ void GeneticAlgorithm::evolve() {
     
     // 4. Actualizar estadísticas después de evolucionar
     updateStatistics();
-    std::cout << "DEBUG - Después de evolución: Fitness Prom=" << averageFitness 
-              << ", Mejor=" << bestFitness << ", Peor=" << worstFitness << std::endl;
+    LOG_DEBUG("DEBUG - Después de evolución: Fitness Prom=%g, Mejor=%g, Peor=%g",
+              averageFitness, bestFitness, worstFitness);
     
     // Imprimir información
-    std::cout << "Evolución completada. Generación " << currentGeneration 
-              << ". Mutaciones: " << mutationsOccurred 
-              << ". Mejor fitness: " << bestFitness << std::endl;
+    LOG_INFO("Evolución completada. Generación %d. Mutaciones: %d. Mejor fitness: %g",
+             currentGeneration, mutationsOccurred, bestFitness);
+}
+
+std::vector<Genome> GeneticAlgorithm::getTopGenomes(int count) const {
+    std::vector<Genome> sorted = population;
+    count = std::max(0, std::min(count, static_cast<int>(sorted.size())));
+    
+    // Solo hace falta ordenar los primeros 'count'
+    std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(),
+                      [](const Genome& a, const Genome& b) { return a.fitness > b.fitness; });
+    sorted.resize(count);
+    return sorted;
+}
+
+void GeneticAlgorithm::replaceWorst(const std::vector<Genome>& incoming) {
+    if (incoming.empty() || population.empty()) {
+        return;
+    }
+    
+    // Ordenar de menor a mayor fitness y sobrescribir los primeros
+    std::sort(population.begin(), population.end(), 
+              [](const Genome& a, const Genome& b) { return a.fitness < b.fitness; });
+    
+    size_t count = std::min(incoming.size(), population.size());
+    for (size_t i = 0; i < count; i++) {
+        population[i] = incoming[i];
+    }
 }
 
 std::vector<Genome> GeneticAlgorithm::selectParents() {
     std::vector<Genome> parents;
     
     // Implementación de selección por torneo
-    std::uniform_int_distribution<int> dist(0, population.size() - 1);
+    int lastIndex = static_cast<int>(population.size()) - 1;
     
     // Seleccionar dos padres
     for (int i = 0; i < 2; i++) {
         // Torneo de 3 individuos
-        int idx1 = dist(rng);
-        int idx2 = dist(rng);
-        int idx3 = dist(rng);
+        int idx1 = rng.nextInt(0, lastIndex);
+        int idx2 = rng.nextInt(0, lastIndex);
+        int idx3 = rng.nextInt(0, lastIndex);
         
         // Seleccionar el mejor
         float fitness1 = population[idx1].fitness;
@@ -187,16 +191,13 @@ std::vector<Genome> GeneticAlgorithm::selectParents() {
 Genome GeneticAlgorithm::crossover(const Genome& parent1, const Genome& parent2) {
     Genome child;
     
-    // Distribución uniforme para el crossover
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    
     // Decidir si hay cruce
-    if (dist(rng) < crossoverRate) {
+    if (rng.nextFloat() < crossoverRate) {
         // Cruce de punto único: para cada atributo, 50% de probabilidad de cada padre
-        child.enemyType = (dist(rng) < 0.5f) ? parent1.enemyType : parent2.enemyType;
+        child.enemyType = (rng.nextFloat() < 0.5f) ? parent1.enemyType : parent2.enemyType;
         
         // Cruce de atributos numéricos: interpolación
-        float alpha = dist(rng);  // Factor de mezcla
+        float alpha = rng.nextFloat();  // Factor de mezcla
         
         child.health = parent1.health * alpha + parent2.health * (1.0f - alpha);
         child.speed = parent1.speed * alpha + parent2.speed * (1.0f - alpha);
@@ -205,52 +206,50 @@ Genome GeneticAlgorithm::crossover(const Genome& parent1, const Genome& parent2)
         child.artilleryResistance = parent1.artilleryResistance * alpha + parent2.artilleryResistance * (1.0f - alpha);
     } else {
         // Sin cruce: copiar uno de los padres directamente
-        child = dist(rng) < 0.5f ? parent1 : parent2;
+        child = rng.nextFloat() < 0.5f ? parent1 : parent2;
     }
     
     return child;
 }
 
 void GeneticAlgorithm::mutate(Genome& genome) {
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
     bool mutated = false;
     
     // Mutación del tipo de enemigo (con menor probabilidad)
-    if (dist(rng) < mutationRate * 0.3f) {
-        std::uniform_int_distribution<int> typeDist(0, 3);
-        genome.enemyType = typeDist(rng);
+    if (rng.nextFloat() < mutationRate * 0.3f) {
+        genome.enemyType = rng.nextInt(0, 3);
         mutated = true;
     }
     
     // Mutación de atributos
-    if (dist(rng) < mutationRate) {
-        genome.health += dist(rng) * 30.0f - 15.0f;  // ±15
+    if (rng.nextFloat() < mutationRate) {
+        genome.health += rng.nextFloat() * 30.0f - 15.0f;  // ±15
         genome.health = std::max(limits.minHealth, std::min(limits.maxHealth, genome.health));
         mutated = true;
     }
     
-    if (dist(rng) < mutationRate) {
-        genome.speed += dist(rng) * 20.0f - 10.0f;  // ±10
+    if (rng.nextFloat() < mutationRate) {
+        genome.speed += rng.nextFloat() * 20.0f - 10.0f;  // ±10
         genome.speed = std::max(limits.minSpeed, std::min(limits.maxSpeed, genome.speed));
         mutated = true;
     }
     
-    if (dist(rng) < mutationRate) {
-        genome.arrowResistance += dist(rng) * 0.4f - 0.2f;  // ±0.2
+    if (rng.nextFloat() < mutationRate) {
+        genome.arrowResistance += rng.nextFloat() * 0.4f - 0.2f;  // ±0.2
         genome.arrowResistance = std::max(limits.minResistance, std::min(limits.maxResistance, genome.arrowResistance));
         mutated = true;
     }
     
-    if (dist(rng) < mutationRate) {
-        genome.magicResistance += dist(rng) * 0.4f - 0.2f;  // ±0.2
+    if (rng.nextFloat() < mutationRate) {
+        genome.magicResistance += rng.nextFloat() * 0.4f - 0.2f;  // ±0.2
         genome.magicResistance = std::max(limits.minResistance, std::min(limits.maxResistance, genome.magicResistance));
         mutated = true;
     }
     
-    if (dist(rng) < mutationRate) {
+    if (rng.nextFloat() < mutationRate) {
         // Las harpías deben mantener su inmunidad a la artillería
         if (genome.enemyType != 2) {  // No es harpía
-            genome.artilleryResistance += dist(rng) * 0.4f - 0.2f;  // ±0.2
+            genome.artilleryResistance += rng.nextFloat() * 0.4f - 0.2f;  // ±0.2
             genome.artilleryResistance = std::max(limits.minResistance, std::min(limits.maxResistance, genome.artilleryResistance));
             mutated = true;
         } else {
@@ -269,13 +268,13 @@ void GeneticAlgorithm::updateStatistics() {
         averageFitness = 0.0f;
         bestFitness = 0.0f;
         worstFitness = 0.0f;
-        std::cout << "ADVERTENCIA: Población vacía al calcular estadísticas!" << std::endl;
+        LOG_WARN("ADVERTENCIA: Población vacía al calcular estadísticas!");
         return;
     }
     
     // Imprimir algunos fitness para depuración
     for (size_t i = 0; i < population.size(); i++) {
-        std::cout << "DEBUG - Genoma " << i << " con fitness: " << population[i].fitness << std::endl;
+        LOG_DEBUG("DEBUG - Genoma %zu con fitness: %g", i, population[i].fitness);
     }
     
     // Calcular fitness promedio
@@ -304,7 +303,6 @@ void GeneticAlgorithm::updateStatistics() {
         worstFitness = 0.0f;
     }
     
-    std::cout << "ESTADÍSTICAS ACTUALIZADAS: Promedio=" << averageFitness 
-              << ", Mejor=" << bestFitness 
-              << ", Peor=" << worstFitness << std::endl;
+    LOG_DEBUG("ESTADÍSTICAS ACTUALIZADAS: Promedio=%g, Mejor=%g, Peor=%g",
+              averageFitness, bestFitness, worstFitness);
 }
\ No newline at end of file
@@ -2,11 +2,11 @@
 #define GENETIC_ALGORITHM_H
 
 #include <vector>
-#include <random>
+#include <cstdint>
 #include <algorithm>
-#include <iostream>
 #include <memory>
-#include "Enemy.h"
+#include "EnemyTypes.h"
+#include "RandomStream.h"
 
 struct Genome {
     float health;
@@ -25,7 +25,7 @@ struct Genome {
 class GeneticAlgorithm {
 private:
     std::vector<Genome> population;
-    std::mt19937 rng;
+    RandomStream rng;
     
     // Configuración del algoritmo genético
     int populationSize;
@@ -52,11 +52,10 @@ private:
     std::vector<Genome> selectParents();
     Genome crossover(const Genome& parent1, const Genome& parent2);
     void mutate(Genome& genome);
-    void updateStatistics();
 
 public:
     GeneticAlgorithm(int populationSize = 20, float mutationRate = 0.1f, 
-                     float crossoverRate = 0.7f, int eliteCount = 2);
+                     float crossoverRate = 0.7f, int eliteCount = 2, uint64_t seed = 0);
     
     // Evolucionar la población
     void evolve();
@@ -64,9 +63,15 @@ public:
     // Inicializar los genomas según los tipos de enemigos
     void initializeGenome(Genome& genome, int enemyType);
     
+    // Fórmula de fitness: priorizar el progreso hacia el puente
+    static float calculateFitness(float progressMade, float damageDealt, float timeAlive);
+    
     // Actualizar el fitness de un genoma basado en el rendimiento del enemigo
     void updateFitness(Genome& genome, float progressMade, float damageDealt, float timeAlive);
     
+    // Recalcular las estadísticas (tras evaluar la población desde fuera)
+    void updateStatistics();
+    
     // Obtener genomas para crear enemigos
     const std::vector<Genome>& getPopulation() const { return population; }
     
@@ -82,6 +87,12 @@ public:
     void setMutationRate(float rate) { mutationRate = rate; }
 
     std::vector<Genome>& getPopulationRef() { return population; }
+    
+    // Mejores genomas de la población (para migración entre islas)
+    std::vector<Genome> getTopGenomes(int count) const;
+    
+    // Reemplazar los peores genomas por los recibidos
+    void replaceWorst(const std::vector<Genome>& incoming);
 
 };
 
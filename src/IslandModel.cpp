@@ -0,0 +1,183 @@
+#include "IslandModel.h"
+#include "RandomStream.h"
+#include <thread>
+#include <limits>
+#include <algorithm>
+
+bool MigrationQueue::push(const Genome& genome) {
+    size_t currentTail = tail.load(std::memory_order_relaxed);
+    size_t nextTail = (currentTail + 1) % CAPACITY;
+
+    if (nextTail == head.load(std::memory_order_acquire)) {
+        return false;  // Llena
+    }
+
+    slots[currentTail] = genome;
+    tail.store(nextTail, std::memory_order_release);
+    return true;
+}
+
+bool MigrationQueue::pop(Genome& genome) {
+    size_t currentHead = head.load(std::memory_order_relaxed);
+
+    if (currentHead == tail.load(std::memory_order_acquire)) {
+        return false;  // Vacía
+    }
+
+    genome = slots[currentHead];
+    head.store((currentHead + 1) % CAPACITY, std::memory_order_release);
+    return true;
+}
+
+IslandModel::IslandModel(int islandCount, int islandPopulation, int interval,
+                         int migrants, uint64_t sessionSeed)
+    : migrationInterval(std::max(1, interval)), generationsRun(0), seed(sessionSeed) {
+
+    islandCount = std::max(1, islandCount);
+    migrantCount = std::max(0, std::min(migrants, std::min(islandPopulation,
+                                                           static_cast<int>(MigrationQueue::capacity() / 2))));
+
+    for (int i = 0; i < islandCount; i++) {
+        // Cada isla con su propia semilla y una tasa de mutación distinta
+        uint64_t islandSeed = RandomStream::forSubsystem(seed, RngStreamId::ISLANDS, i)();
+        float mutationRate = 0.05f + 0.05f * (i % 4);
+
+        islands.emplace_back(islandPopulation, mutationRate, 0.7f, 2, islandSeed);
+        inboxes.push_back(std::make_unique<MigrationQueue>());
+    }
+}
+
+void IslandModel::runGenerations(int generations, const EvaluateFunction& evaluate) {
+    // Un hilo por isla; no comparten datos salvo las colas de migración
+    std::vector<std::thread> threads;
+    for (int i = 0; i < static_cast<int>(islands.size()); i++) {
+        threads.emplace_back(&IslandModel::runIsland, this, i, generations, std::cref(evaluate));
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    generationsRun += generations;
+}
+
+uint64_t IslandModel::evaluationSeed(int index, int generation) const {
+    // Por isla y generación (independiente del orden de los hilos)
+    return RandomStream::forSubsystem(
+        seed, RngStreamId::FITNESS_EVALUATION,
+        (static_cast<uint64_t>(index) << 32) | static_cast<uint64_t>(generation))();
+}
+
+void IslandModel::runIsland(int index, int generations, const EvaluateFunction& evaluate) {
+    GeneticAlgorithm& island = islands[index];
+
+    for (int g = 0; g < generations; g++) {
+        int generation = generationsRun + g;
+
+        evaluate(island.getPopulationRef(), evaluationSeed(index, generation));
+
+        // Migración periódica, antes de evolucionar: los que emigran y los que
+        // se sustituyen se eligen con el fitness recién evaluado (tras evolve()
+        // los hijos aún no tienen fitness), y los que llegan ya pueden ser padres
+        if (migrantCount > 0 && (generation + 1) % migrationInterval == 0) {
+            migrate(index);
+        }
+
+        island.evolve();
+    }
+
+    // La última evolve() deja hijos sin evaluar (fitness 0): se evalúa la
+    // población final (con la semilla de la generación siguiente, la misma que
+    // usaría otra llamada) para que getTopGenomes y las estadísticas sean reales
+    if (generations > 0) {
+        evaluate(island.getPopulationRef(), evaluationSeed(index, generationsRun + generations));
+        island.updateStatistics();
+    }
+}
+
+void IslandModel::migrate(int index) {
+    int islandCount = static_cast<int>(islands.size());
+    MigrationQueue& outbox = *inboxes[(index + 1) % islandCount];
+    MigrationQueue& inbox = *inboxes[index];
+
+    // Enviar los mejores a la isla siguiente
+    std::vector<Genome> migrants = islands[index].getTopGenomes(migrantCount);
+    for (const Genome& genome : migrants) {
+        while (!outbox.push(genome)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Esperar a los que envía la isla anterior (todas migran en la misma
+    // generación, así el resultado no depende de la velocidad de cada hilo)
+    std::vector<Genome> incoming;
+    incoming.reserve(migrants.size());
+    Genome genome;
+    while (incoming.size() < migrants.size()) {
+        if (inbox.pop(genome)) {
+            incoming.push_back(genome);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    islands[index].replaceWorst(incoming);
+}
+
+std::vector<Genome> IslandModel::getTopGenomes(int count) const {
+    std::vector<Genome> all;
+    for (const auto& island : islands) {
+        const std::vector<Genome>& population = island.getPopulation();
+        all.insert(all.end(), population.begin(), population.end());
+    }
+
+    count = std::max(0, std::min(count, static_cast<int>(all.size())));
+    std::partial_sort(all.begin(), all.begin() + count, all.end(),
+                      [](const Genome& a, const Genome& b) { return a.fitness > b.fitness; });
+    all.resize(count);
+    return all;
+}
+
+int IslandModel::getGeneration() const {
+    int generation = 0;
+    for (const auto& island : islands) {
+        generation = std::max(generation, island.getGeneration());
+    }
+    return generation;
+}
+
+int IslandModel::getMutationsOccurred() const {
+    int total = 0;
+    for (const auto& island : islands) {
+        total += island.getMutationsOccurred();
+    }
+    return total;
+}
+
+float IslandModel::getAverageFitness() const {
+    // Promedio ponderado por el tamaño de cada población
+    float total = 0.0f;
+    size_t count = 0;
+    for (const auto& island : islands) {
+        size_t size = island.getPopulation().size();
+        total += island.getAverageFitness() * size;
+        count += size;
+    }
+    return count > 0 ? total / count : 0.0f;
+}
+
+float IslandModel::getBestFitness() const {
+    float best = 0.0f;
+    for (const auto& island : islands) {
+        best = std::max(best, island.getBestFitness());
+    }
+    return best;
+}
+
+float IslandModel::getWorstFitness() const {
+    float worst = std::numeric_limits<float>::max();
+    for (const auto& island : islands) {
+        worst = std::min(worst, island.getWorstFitness());
+    }
+    return islands.empty() ? 0.0f : worst;
+}
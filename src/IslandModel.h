@@ -0,0 +1,79 @@
+#ifndef ISLAND_MODEL_H
+#define ISLAND_MODEL_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <cstdint>
+#include "GeneticAlgorithm.h"
+
+// Cola sin bloqueos de un productor y un consumidor para migrar genomas
+// entre dos islas vecinas (solo la isla anterior escribe y solo esta lee)
+class MigrationQueue {
+private:
+    static const size_t CAPACITY = 64;
+    Genome slots[CAPACITY];
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+
+public:
+    MigrationQueue() : head(0), tail(0) {}
+
+    // Devuelve false si la cola está llena
+    bool push(const Genome& genome);
+
+    // Devuelve false si la cola está vacía
+    bool pop(Genome& genome);
+
+    static size_t capacity() { return CAPACITY - 1; }
+};
+
+// Modelo de islas: K poblaciones que evolucionan a la vez en hilos separados,
+// cada una con su propio generador y parámetros. Cada cierto número de
+// generaciones las mejores migran a la isla siguiente (topología en anillo).
+class IslandModel {
+public:
+    // Función de evaluación: debe poder llamarse desde varios hilos a la vez
+    using EvaluateFunction = std::function<void(std::vector<Genome>&, uint64_t seed)>;
+
+private:
+    std::vector<GeneticAlgorithm> islands;
+    std::vector<std::unique_ptr<MigrationQueue>> inboxes;  // inboxes[i]: genomas que llegan a la isla i
+
+    int migrationInterval;   // Generaciones entre migraciones
+    int migrantCount;        // Genomas que emigran en cada migración
+    int generationsRun;      // Generaciones completadas
+    uint64_t seed;
+
+    // Semilla de evaluación de una isla en una generación
+    uint64_t evaluationSeed(int index, int generation) const;
+
+    // Bucle de una isla (se ejecuta en su propio hilo)
+    void runIsland(int index, int generations, const EvaluateFunction& evaluate);
+
+    // Enviar los mejores a la isla vecina y recibir los de la anterior
+    void migrate(int index);
+
+public:
+    IslandModel(int islandCount = 4, int islandPopulation = 20, int migrationInterval = 5,
+                int migrantCount = 2, uint64_t seed = 0);
+
+    // Evoluciona todas las islas 'generations' generaciones en paralelo
+    void runGenerations(int generations, const EvaluateFunction& evaluate);
+
+    // Mejores genomas de todas las islas
+    std::vector<Genome> getTopGenomes(int count) const;
+
+    // Estadísticas agregadas de todas las islas
+    int getIslandCount() const { return static_cast<int>(islands.size()); }
+    int getGeneration() const;
+    int getMutationsOccurred() const;
+    float getAverageFitness() const;
+    float getBestFitness() const;
+    float getWorstFitness() const;
+
+    const GeneticAlgorithm& getIsland(int index) const { return islands[index]; }
+};
+
+#endif // ISLAND_MODEL_H
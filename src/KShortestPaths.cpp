@@ -0,0 +1,263 @@
+#include "KShortestPaths.h"
+#include "AStar.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+// Direcciones (arriba, derecha, abajo, izquierda), las mismas que usa A*
+const int DX[] = {0, 1, 0, -1};
+const int DY[] = {-1, 0, 1, 0};
+
+// Celdas bloqueadas de una búsqueda de desvío (una por hilo, con marcas de
+// generación como el contexto de AStar para no limpiar el array cada vez)
+struct BlockedCells {
+    std::vector<uint32_t> stamp;
+    uint32_t generation = 0;
+
+    void prepare(size_t cellCount) {
+        if (stamp.size() < cellCount) {
+            stamp.resize(cellCount, 0);
+        }
+        if (++generation == 0) {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            generation = 1;
+        }
+    }
+};
+}
+
+KShortestPaths::KShortestPaths(int maxPaths, float maxOverlap, int maxSpurSearches, int threadCount)
+    : maxPaths(maxPaths), maxOverlap(maxOverlap), maxSpurSearches(maxSpurSearches), threadCount(threadCount),
+      cacheValid(false), cachedVersion(0), candidateOrder(0), markGeneration(0), lastSpurSearches(0) {
+    if (this->threadCount <= 0) {
+        this->threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (this->threadCount <= 0) this->threadCount = 1;
+    }
+}
+
+bool KShortestPaths::searchSpur(const WalkableBitmap& walkableMap, const std::vector<SDL_Point>& previous,
+                                size_t spurIndex, std::vector<SDL_Point>& spurPath) const {
+    int rows = walkableMap.getRows();
+    int cols = walkableMap.getCols();
+    thread_local BlockedCells blocked;
+    blocked.prepare(static_cast<size_t>(rows) * cols);
+    const uint32_t generation = blocked.generation;
+
+    // El tramo hasta el nodo de desvío no se puede volver a pisar (camino simple)
+    for (size_t i = 0; i < spurIndex; i++) {
+        blocked.stamp[previous[i].y * cols + previous[i].x] = generation;
+    }
+
+    // Ni seguir como un camino ya aceptado que comparte ese mismo tramo
+    for (const std::vector<SDL_Point>& accepted : result) {
+        if (accepted.size() > spurIndex + 1 &&
+            std::equal(accepted.begin(), accepted.begin() + spurIndex + 1, previous.begin())) {
+            const SDL_Point& next = accepted[spurIndex + 1];
+            blocked.stamp[next.y * cols + next.x] = generation;
+        }
+    }
+
+    const FlowField& distances = distanceToGoal;
+    const uint32_t* stamps = blocked.stamp.data();
+    auto isWalkable = [&walkableMap, &distances, stamps, generation, cols](int x, int y) {
+        return walkableMap.isWalkable(x, y) && stamps[y * cols + x] != generation &&
+               distances.getDistance(x, y) != FlowField::UNREACHABLE;
+    };
+
+    // Primero el árbol inverso: si desde el mejor vecino libre se puede bajar
+    // por distancias decrecientes sin tocar celdas bloqueadas, ese es ya un
+    // desvío de longitud mínima (bloquear celdas nunca acorta distancias)
+    SDL_Point spur = previous[spurIndex];
+    int bestDistance = FlowField::UNREACHABLE;
+    for (int i = 0; i < 4; i++) {
+        int nx = spur.x + DX[i];
+        int ny = spur.y + DY[i];
+        if (nx >= 0 && nx < cols && ny >= 0 && ny < rows && isWalkable(nx, ny)) {
+            int distance = distances.getDistance(nx, ny);
+            if (bestDistance == FlowField::UNREACHABLE || distance < bestDistance) {
+                bestDistance = distance;
+            }
+        }
+    }
+    if (bestDistance == FlowField::UNREACHABLE) {
+        spurPath.clear();
+        return false;
+    }
+
+    spurPath.resize(bestDistance + 2);
+    spurPath[0] = spur;
+    SDL_Point cell = spur;
+    bool descended = true;
+    for (int step = 1; step < static_cast<int>(spurPath.size()) && descended; step++) {
+        int wanted = bestDistance + 1 - step;
+        descended = false;
+        for (int i = 0; i < 4; i++) {
+            int nx = cell.x + DX[i];
+            int ny = cell.y + DY[i];
+            if (nx >= 0 && nx < cols && ny >= 0 && ny < rows &&
+                distances.getDistance(nx, ny) == wanted && isWalkable(nx, ny)) {
+                cell = {nx, ny};
+                spurPath[step] = cell;
+                descended = true;
+                break;
+            }
+        }
+    }
+    if (descended) {
+        return true;
+    }
+
+    // Si el descenso se atasca, A* con las distancias del árbol como heurística
+    auto heuristic = [&distances](int x, int y) { return distances.getDistance(x, y); };
+    return AStar::findPath(isWalkable, heuristic, spur, previous.back(), cols, rows, spurPath);
+}
+
+void KShortestPaths::runSpurSearches(const WalkableBitmap& walkableMap, const std::vector<SDL_Point>& previous,
+                                     size_t firstSpur, size_t lastSpur) {
+    if (spurPaths.size() < lastSpur) {
+        spurPaths.resize(lastSpur);
+    }
+    spurFound.assign(lastSpur, 0);
+
+    // Cada hilo toma una de cada 'step' búsquedas y escribe solo en sus posiciones
+    auto work = [this, &walkableMap, &previous, lastSpur](size_t first, size_t step) {
+        for (size_t i = first; i < lastSpur; i += step) {
+            spurFound[i] = searchSpur(walkableMap, previous, i, spurPaths[i]) ? 1 : 0;
+        }
+    };
+
+    size_t threads = std::min(static_cast<size_t>(threadCount), (lastSpur - firstSpur) / MIN_SPURS_PER_THREAD);
+    if (threads <= 1) {
+        work(firstSpur, 1);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t t = 1; t < threads; t++) {
+        workers.emplace_back(work, firstSpur + t, threads);
+    }
+    work(firstSpur, threads);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+float KShortestPaths::overlap(const std::vector<SDL_Point>& path, const std::vector<SDL_Point>& other, int cols) {
+    if (path.empty()) {
+        return 0.0f;
+    }
+    if (++markGeneration == 0) {
+        std::fill(cellMark.begin(), cellMark.end(), 0);
+        markGeneration = 1;
+    }
+
+    for (const SDL_Point& cell : other) {
+        cellMark[cell.y * cols + cell.x] = markGeneration;
+    }
+    size_t shared = 0;
+    for (const SDL_Point& cell : path) {
+        if (cellMark[cell.y * cols + cell.x] == markGeneration) {
+            shared++;
+        }
+    }
+    return static_cast<float>(shared) / path.size();
+}
+
+bool KShortestPaths::isKnownPath(const std::vector<SDL_Point>& path) const {
+    for (const std::vector<SDL_Point>& accepted : result) {
+        if (accepted == path) return true;
+    }
+    for (const Candidate& candidate : candidates) {
+        if (candidate.path == path) return true;
+    }
+    return false;
+}
+
+const std::vector<std::vector<SDL_Point>>& KShortestPaths::find(const WalkableBitmap& walkableMap, uint32_t version,
+                                                                const std::vector<SDL_Point>& firstPath) {
+    lastSpurSearches = 0;
+    if (cacheValid && version == cachedVersion && firstPath == cachedFirstPath) {
+        return result;
+    }
+    cacheValid = true;
+    cachedVersion = version;
+    cachedFirstPath = firstPath;
+
+    result.clear();
+    resultDeviation.clear();
+    candidates.clear();
+    candidateOrder = 0;
+    if (firstPath.empty()) {
+        return result;
+    }
+    result.push_back(firstPath);
+    resultDeviation.push_back(0);
+    if (firstPath.size() < 2) {
+        return result;
+    }
+
+    // Árbol inverso desde el destino, común a todas las búsquedas de desvío
+    int cols = walkableMap.getCols();
+    distanceToGoal.compute(walkableMap, firstPath.back());
+    size_t cellCount = static_cast<size_t>(walkableMap.getRows()) * cols;
+    if (cellMark.size() != cellCount) {
+        cellMark.assign(cellCount, 0);
+        markGeneration = 0;
+    }
+
+    while (static_cast<int>(result.size()) < maxPaths && lastSpurSearches < maxSpurSearches) {
+        // Desvíos desde las celdas del último camino aceptado (menos el destino).
+        // Los anteriores a su propio punto de desvío ya se probaron desde el camino
+        // del que salió (mejora de Lawler), así que se empieza en ese punto
+        size_t previousIndex = result.size() - 1;
+        const std::vector<SDL_Point>& previous = result[previousIndex];
+        size_t firstSpur = resultDeviation[previousIndex];
+        size_t lastSpur = std::min(previous.size() - 1,
+                                   firstSpur + static_cast<size_t>(maxSpurSearches - lastSpurSearches));
+        runSpurSearches(walkableMap, previous, firstSpur, lastSpur);
+        lastSpurSearches += static_cast<int>(lastSpur - firstSpur);
+
+        // Tramo común + desvío (en el orden de los nodos, para que no dependa de los hilos)
+        for (size_t i = firstSpur; i < lastSpur; i++) {
+            if (!spurFound[i]) {
+                continue;
+            }
+            std::vector<SDL_Point> path(previous.begin(), previous.begin() + i);
+            path.insert(path.end(), spurPaths[i].begin(), spurPaths[i].end());
+            if (!isKnownPath(path)) {
+                candidates.push_back({std::move(path), i, candidateOrder++});
+            }
+        }
+
+        // Aceptar el candidato más corto que sea lo bastante distinto de los aceptados
+        bool accepted = false;
+        while (!candidates.empty() && !accepted) {
+            auto best = std::min_element(candidates.begin(), candidates.end(),
+                                         [](const Candidate& a, const Candidate& b) {
+                                             if (a.path.size() != b.path.size()) return a.path.size() < b.path.size();
+                                             return a.order < b.order;
+                                         });
+            std::vector<SDL_Point> path = std::move(best->path);
+            size_t deviation = best->deviation;
+            candidates.erase(best);
+
+            bool diverse = true;
+            for (const std::vector<SDL_Point>& existing : result) {
+                if (overlap(path, existing, cols) > maxOverlap) {
+                    diverse = false;
+                    break;
+                }
+            }
+            if (diverse) {
+                result.push_back(std::move(path));
+                resultDeviation.push_back(deviation);
+                accepted = true;
+            }
+        }
+        if (!accepted) {
+            break;
+        }
+    }
+    return result;
+}
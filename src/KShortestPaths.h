@@ -0,0 +1,95 @@
+#ifndef K_SHORTEST_PATHS_H
+#define K_SHORTEST_PATHS_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "WalkableBitmap.h"
+#include "FlowField.h"
+
+// Caminos alternativos al principal con el algoritmo de Yen: cada camino nuevo
+// se desvía de uno ya aceptado en alguna de sus celdas (el nodo de desvío),
+// manteniendo el tramo anterior y prohibiendo las continuaciones ya usadas.
+//
+// - Las búsquedas de desvío comparten un mismo árbol inverso (las distancias
+//   hasta el destino, calculadas una vez por versión del tablero) que sirve de
+//   heurística exacta para el A* y descarta las celdas que no llegan al destino.
+// - Las búsquedas de una misma iteración son independientes y se reparten entre
+//   hilos cuando hay suficientes; el resultado no depende del número de hilos.
+// - Solo se aceptan caminos diversos: que no compartan más de maxOverlap de sus
+//   celdas con ningún camino ya aceptado.
+// - El resultado se guarda por versión del tablero y camino principal.
+//
+// Las continuaciones prohibidas se bloquean como celdas (no como aristas): los
+// caminos que salen son simples y distintos, aunque Yen exacto podría encontrar
+// alguno más.
+class KShortestPaths {
+private:
+    int maxPaths;
+    float maxOverlap;
+    int maxSpurSearches;   // Límite de búsquedas de desvío por cálculo
+    int threadCount;
+
+    // Caché del último cálculo
+    bool cacheValid;
+    uint32_t cachedVersion;
+    std::vector<SDL_Point> cachedFirstPath;
+    std::vector<std::vector<SDL_Point>> result;
+    std::vector<size_t> resultDeviation;  // Celda en la que cada camino se desvió del anterior
+
+    // Árbol inverso compartido por las búsquedas de desvío
+    FlowField distanceToGoal;
+
+    // Caminos candidatos pendientes (orden = momento en que se encontraron,
+    // para desempatar caminos de la misma longitud)
+    struct Candidate {
+        std::vector<SDL_Point> path;
+        size_t deviation;
+        int order;
+    };
+    std::vector<Candidate> candidates;
+    int candidateOrder;
+
+    // Resultado de la búsqueda desde cada nodo de desvío de la iteración actual
+    std::vector<std::vector<SDL_Point>> spurPaths;
+    std::vector<uint8_t> spurFound;
+
+    // Marcas por celda para medir el solapamiento entre caminos
+    std::vector<uint32_t> cellMark;
+    uint32_t markGeneration;
+
+    int lastSpurSearches;
+
+    // Busca el desvío desde previous[spurIndex] hasta el destino (sin pasar por
+    // las celdas anteriores ni por las continuaciones ya aceptadas)
+    bool searchSpur(const WalkableBitmap& walkableMap, const std::vector<SDL_Point>& previous,
+                    size_t spurIndex, std::vector<SDL_Point>& spurPath) const;
+
+    // Búsquedas de desvío de [firstSpur, lastSpur) en spurPaths, en paralelo si compensa
+    void runSpurSearches(const WalkableBitmap& walkableMap, const std::vector<SDL_Point>& previous,
+                         size_t firstSpur, size_t lastSpur);
+
+    // Fracción de las celdas de 'path' que también están en 'other'
+    float overlap(const std::vector<SDL_Point>& path, const std::vector<SDL_Point>& other, int cols);
+
+    bool isKnownPath(const std::vector<SDL_Point>& path) const;
+
+public:
+    // Búsquedas por hilo a partir de las que se reparten en paralelo
+    static constexpr size_t MIN_SPURS_PER_THREAD = 32;
+
+    // threadCount <= 0 usa todos los núcleos disponibles
+    KShortestPaths(int maxPaths = 3, float maxOverlap = 0.7f, int maxSpurSearches = 512, int threadCount = 0);
+
+    // Hasta maxPaths caminos de celdas, empezando por firstPath (el principal,
+    // de su inicio a su destino); los demás, de más corto a más largo. Si la
+    // versión del mapa y el camino principal no cambian, devuelve la caché.
+    const std::vector<std::vector<SDL_Point>>& find(const WalkableBitmap& walkableMap, uint32_t version,
+                                                    const std::vector<SDL_Point>& firstPath);
+
+    // Búsquedas de desvío del último cálculo (0 si salió de la caché)
+    int getLastSpurSearches() const { return lastSpurSearches; }
+};
+
+#endif // K_SHORTEST_PATHS_H
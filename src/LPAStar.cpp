@@ -0,0 +1,205 @@
+#include "LPAStar.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+// Direcciones (arriba, derecha, abajo, izquierda), las mismas que usa A*
+const int DX[] = {0, 1, 0, -1};
+const int DY[] = {-1, 0, 1, 0};
+}
+
+LPAStar::LPAStar()
+    : rows(0), cols(0), startCell(-1), goalCell(-1), initialized(false), mapVersion(0), lastExpansions(0) {
+}
+
+int LPAStar::heuristic(int cell) const {
+    // Distancia de Manhattan hasta el destino
+    return std::abs(cell % cols - goalCell % cols) + std::abs(cell / cols - goalCell / cols);
+}
+
+void LPAStar::calculateKey(int cell, int& k1, int& k2) const {
+    k2 = std::min(g[cell], rhs[cell]);
+    k1 = k2 >= INF ? INF : k2 + heuristic(cell);
+}
+
+void LPAStar::updateVertex(int cell) {
+    // rhs: mejor distancia a través de un vecino (una celda no caminable no tiene)
+    if (cell != startCell) {
+        int best = INF;
+        int x = cell % cols;
+        int y = cell / cols;
+        if (walkable.isWalkable(x, y)) {
+            for (int i = 0; i < 4; i++) {
+                int nx = x + DX[i];
+                int ny = y + DY[i];
+                if (nx >= 0 && nx < cols && ny >= 0 && ny < rows) {
+                    int neighborG = g[ny * cols + nx];
+                    if (neighborG < INF && neighborG + 1 < best) {
+                        best = neighborG + 1;
+                    }
+                }
+            }
+        }
+        rhs[cell] = best;
+    }
+
+    // Solo las celdas inconsistentes están en la cola
+    inOpen[cell] = 0;
+    if (g[cell] != rhs[cell]) {
+        int k1, k2;
+        calculateKey(cell, k1, k2);
+        inOpen[cell] = 1;
+        openKey1[cell] = k1;
+        openKey2[cell] = k2;
+        open.push_back({k1, k2, cell});
+        std::push_heap(open.begin(), open.end());
+    }
+}
+
+void LPAStar::computeShortestPath() {
+    while (!open.empty()) {
+        // Descartar las entradas obsoletas de la cima
+        const QueueEntry& top = open.front();
+        if (!inOpen[top.cell] || openKey1[top.cell] != top.k1 || openKey2[top.cell] != top.k2) {
+            std::pop_heap(open.begin(), open.end());
+            open.pop_back();
+            continue;
+        }
+
+        // Parar cuando el destino es consistente y nada en la cola puede mejorarlo
+        int goalK1, goalK2;
+        calculateKey(goalCell, goalK1, goalK2);
+        bool topBeforeGoal = top.k1 < goalK1 || (top.k1 == goalK1 && top.k2 < goalK2);
+        if (!topBeforeGoal && rhs[goalCell] == g[goalCell]) {
+            break;
+        }
+
+        int cell = top.cell;
+        std::pop_heap(open.begin(), open.end());
+        open.pop_back();
+        inOpen[cell] = 0;
+        lastExpansions++;
+
+        int x = cell % cols;
+        int y = cell / cols;
+        if (g[cell] > rhs[cell]) {
+            // Sobreconsistente: la distancia mejora y se propaga a los vecinos
+            g[cell] = rhs[cell];
+        } else {
+            // Infraconsistente: la distancia empeoró; se recalcula la celda y sus vecinos
+            g[cell] = INF;
+            updateVertex(cell);
+        }
+
+        for (int i = 0; i < 4; i++) {
+            int nx = x + DX[i];
+            int ny = y + DY[i];
+            if (nx >= 0 && nx < cols && ny >= 0 && ny < rows) {
+                updateVertex(ny * cols + nx);
+            }
+        }
+    }
+}
+
+void LPAStar::reset(const WalkableBitmap& walkableMap, int start, int goal) {
+    rows = walkableMap.getRows();
+    cols = walkableMap.getCols();
+    startCell = start;
+    goalCell = goal;
+
+    size_t cellCount = static_cast<size_t>(rows) * cols;
+    walkable = walkableMap;
+    g.assign(cellCount, INF);
+    rhs.assign(cellCount, INF);
+    inOpen.assign(cellCount, 0);
+    openKey1.assign(cellCount, 0);
+    openKey2.assign(cellCount, 0);
+    open.clear();
+
+    // El inicio es la única celda con rhs conocido
+    rhs[startCell] = 0;
+    updateVertex(startCell);
+    initialized = true;
+}
+
+bool LPAStar::findPath(const WalkableBitmap& walkableMap, uint32_t version,
+                       SDL_Point start, SDL_Point goal, std::vector<SDL_Point>& path) {
+    path.clear();
+    lastExpansions = 0;
+    int mapRows = walkableMap.getRows();
+    int mapCols = walkableMap.getCols();
+    if (mapRows <= 0 || mapCols <= 0 ||
+        start.x < 0 || start.x >= mapCols || start.y < 0 || start.y >= mapRows ||
+        goal.x < 0 || goal.x >= mapCols || goal.y < 0 || goal.y >= mapRows) {
+        return false;
+    }
+
+    int startIndex = start.y * mapCols + start.x;
+    int goalIndex = goal.y * mapCols + goal.x;
+    if (!initialized || mapRows != rows || mapCols != cols || startIndex != startCell || goalIndex != goalCell) {
+        reset(walkableMap, startIndex, goalIndex);
+    } else if (version != mapVersion) {
+        // Solo las celdas que cambiaron (y sus vecinos, que dependían de ellas):
+        // se comparan 64 celdas de golpe y se recorren los bits distintos
+        int wordsPerRow = walkable.getWordsPerRow();
+        for (int y = 0; y < rows; y++) {
+            const uint64_t* oldRow = walkable.getRow(y);
+            const uint64_t* newRow = walkableMap.getRow(y);
+            for (int w = 0; w < wordsPerRow; w++) {
+                uint64_t changed = oldRow[w] ^ newRow[w];
+                while (changed != 0) {
+                    int x = w * 64 + __builtin_ctzll(changed);
+                    changed &= changed - 1;
+                    walkable.set(x, y, walkableMap.isWalkable(x, y));
+
+                    int c = y * cols + x;
+                    updateVertex(c);
+                    for (int i = 0; i < 4; i++) {
+                        int nx = x + DX[i];
+                        int ny = y + DY[i];
+                        if (nx >= 0 && nx < cols && ny >= 0 && ny < rows) {
+                            updateVertex(ny * cols + nx);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    mapVersion = version;
+
+    computeShortestPath();
+
+    if (g[goalCell] >= INF) {
+        return false;
+    }
+
+    // Reconstruir desde el destino bajando por g (cada paso resta 1)
+    path.resize(g[goalCell] + 1);
+    int cell = goalCell;
+    for (size_t i = path.size(); i-- > 0; ) {
+        path[i] = {cell % cols, cell / cols};
+        if (cell == startCell) {
+            break;
+        }
+
+        // Vecino un paso más cerca del inicio (preferimos los consistentes: una
+        // celda pendiente en la cola puede conservar una g antigua)
+        int x = cell % cols;
+        int y = cell / cols;
+        int previous = -1;
+        for (int d = 0; d < 4 && (previous == -1 || g[previous] != rhs[previous]); d++) {
+            int nx = x + DX[d];
+            int ny = y + DY[d];
+            if (nx >= 0 && nx < cols && ny >= 0 && ny < rows && g[ny * cols + nx] == g[cell] - 1 &&
+                (previous == -1 || g[ny * cols + nx] == rhs[ny * cols + nx])) {
+                previous = ny * cols + nx;
+            }
+        }
+        if (previous == -1) {
+            path.clear();
+            return false;
+        }
+        cell = previous;
+    }
+    return true;
+}
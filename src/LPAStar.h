@@ -0,0 +1,66 @@
+#ifndef LPASTAR_H
+#define LPASTAR_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "WalkableBitmap.h"
+
+// Lifelong Planning A* (Koenig y Likhachev) sobre la cuadrícula del tablero:
+// un A* que conserva su estado (g, rhs y la cola) entre llamadas. Cuando cambian
+// algunas celdas solo se reparan las afectadas y las que dependían de ellas, en
+// lugar de repetir la búsqueda completa. Vecindad 4 y coste 1 por paso, como AStar.
+class LPAStar {
+public:
+    static constexpr int INF = 1 << 29;
+
+private:
+    // Entrada de la cola (las obsoletas se descartan al sacarlas)
+    struct QueueEntry {
+        int k1, k2;
+        int cell;
+
+        // Montículo de mínimos por clave (k1, k2)
+        bool operator<(const QueueEntry& other) const {
+            return k1 > other.k1 || (k1 == other.k1 && k2 > other.k2);
+        }
+    };
+
+    int rows;
+    int cols;
+    int startCell;
+    int goalCell;
+    bool initialized;
+    uint32_t mapVersion;
+
+    WalkableBitmap walkable;         // Copia del mapa con el que se calculó el estado
+    std::vector<int> g;              // Distancia consolidada desde el inicio
+    std::vector<int> rhs;            // Distancia según los vecinos (g == rhs: consistente)
+    std::vector<uint8_t> inOpen;     // La celda está en la cola con la clave openKey
+    std::vector<int> openKey1;
+    std::vector<int> openKey2;
+    std::vector<QueueEntry> open;
+
+    int lastExpansions;              // Celdas expandidas en la última llamada
+
+    int heuristic(int cell) const;
+    void calculateKey(int cell, int& k1, int& k2) const;
+    void updateVertex(int cell);
+    void computeShortestPath();
+    void reset(const WalkableBitmap& walkableMap, int start, int goal);
+
+public:
+    LPAStar();
+
+    // Camino de start a goal (celdas, ambos incluidos) sobre un mapa de celdas
+    // caminables. Si solo cambió el mapa respecto a la llamada anterior (otra
+    // versión), se reparan las celdas cambiadas (se comparan palabra a palabra);
+    // si cambian las dimensiones, el inicio o el destino, se empieza de cero.
+    bool findPath(const WalkableBitmap& walkableMap, uint32_t version,
+                  SDL_Point start, SDL_Point goal, std::vector<SDL_Point>& path);
+
+    int getLastExpansions() const { return lastExpansions; }
+};
+
+#endif // LPASTAR_H
@@ -0,0 +1,132 @@
+#include "Logger.h"
+#include <cstdio>
+#include <cstdarg>
+#include <cstring>
+#include <chrono>
+
+Logger::Logger()
+    : records(new Record[CAPACITY]), enqueuePosition(0), writtenCount(0),
+      minLevel(LOG_COMPILE_LEVEL), running(true) {
+    for (size_t i = 0; i < CAPACITY; i++) {
+        records[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    writer = std::thread(&Logger::writeLoop, this);
+}
+
+Logger::~Logger() {
+    // El hilo de fondo escribe lo pendiente antes de terminar
+    running.store(false, std::memory_order_release);
+    if (writer.joinable()) {
+        writer.join();
+    }
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+void Logger::log(LogLevel level, const char* format, ...) {
+    // Reservar una casilla (varios hilos pueden registrar a la vez)
+    size_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Record* record;
+    for (;;) {
+        record = &records[position & (CAPACITY - 1)];
+        size_t sequence = record->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // Buffer lleno: esperar a que el hilo de fondo libere sitio
+            std::this_thread::yield();
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Formatear directamente en la casilla
+    va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(record->text, MESSAGE_SIZE, format, args);
+    va_end(args);
+
+    if (length < 0) {
+        length = 0;
+    } else if (length >= static_cast<int>(MESSAGE_SIZE)) {
+        length = MESSAGE_SIZE - 1;  // Mensaje truncado
+    }
+    record->level = level;
+    record->length = static_cast<uint16_t>(length);
+
+    // Publicar el mensaje
+    record->sequence.store(position + 1, std::memory_order_release);
+}
+
+size_t Logger::drain(size_t& dequeuePosition) {
+    size_t count = 0;
+    for (;;) {
+        Record& record = records[dequeuePosition & (CAPACITY - 1)];
+        if (record.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+            break;  // Vacío o el siguiente mensaje aún se está formateando
+        }
+
+        FILE* stream = record.level >= LogLevel::WARN ? stderr : stdout;
+        if (stream == stderr) {
+            std::fflush(stdout);  // Conservar el orden entre las dos salidas
+        }
+        std::fwrite(record.text, 1, record.length, stream);
+        std::fputc('\n', stream);
+
+        // Liberar la casilla para la siguiente vuelta del buffer
+        record.sequence.store(dequeuePosition + CAPACITY, std::memory_order_release);
+        dequeuePosition++;
+        count++;
+    }
+
+    if (count > 0) {
+        std::fflush(stdout);
+        writtenCount.fetch_add(count, std::memory_order_release);
+    }
+    return count;
+}
+
+void Logger::writeLoop() {
+    size_t dequeuePosition = 0;
+    while (running.load(std::memory_order_acquire)) {
+        if (drain(dequeuePosition) == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    // Escribir lo que quede al cerrar
+    while (dequeuePosition < enqueuePosition.load(std::memory_order_acquire)) {
+        if (drain(dequeuePosition) == 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void Logger::flush() {
+    size_t target = enqueuePosition.load(std::memory_order_acquire);
+    while (writtenCount.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+bool Logger::parseLevel(const char* name, LogLevel& level) {
+    static const struct { const char* name; LogLevel level; } LEVELS[] = {
+        {"trace", LogLevel::TRACE}, {"debug", LogLevel::DEBUG}, {"info", LogLevel::INFO},
+        {"warn", LogLevel::WARN}, {"error", LogLevel::ERROR}
+    };
+    for (const auto& entry : LEVELS) {
+        if (std::strcmp(name, entry.name) == 0) {
+            level = entry.level;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,135 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// Niveles de log (también como números para el preprocesador)
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_WARN  3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_OFF   5
+
+// Nivel mínimo que se compila; los mensajes por debajo desaparecen del binario.
+// Se elige con la variable LOG_LEVEL del Makefile (por defecto INFO).
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#endif
+
+enum class LogLevel : uint8_t {
+    TRACE = LOG_LEVEL_TRACE,
+    DEBUG = LOG_LEVEL_DEBUG,
+    INFO = LOG_LEVEL_INFO,
+    WARN = LOG_LEVEL_WARN,
+    ERROR = LOG_LEVEL_ERROR
+};
+
+// Logger asíncrono: quien registra un mensaje lo formatea (printf) en una
+// casilla de un buffer circular sin bloqueos y sigue; un hilo de fondo vacía
+// el buffer a stdout (WARN y ERROR a stderr) en el mismo orden. Si el buffer se
+// llena, quien registra espera a que haya sitio (no se pierden mensajes).
+class Logger {
+public:
+    static const size_t CAPACITY = 8192;      // Mensajes en el buffer (potencia de 2)
+    static const size_t MESSAGE_SIZE = 256;   // Longitud máxima de un mensaje
+
+private:
+    struct Record {
+        std::atomic<size_t> sequence;  // Estado de la casilla (algoritmo de Vyukov)
+        LogLevel level;
+        uint16_t length;
+        char text[MESSAGE_SIZE];
+    };
+
+    std::unique_ptr<Record[]> records;
+    std::atomic<size_t> enqueuePosition;
+    std::atomic<size_t> writtenCount;    // Mensajes ya escritos por el hilo de fondo
+    std::atomic<int> minLevel;           // Nivel mínimo en tiempo de ejecución
+    std::atomic<bool> running;
+    std::thread writer;
+
+    Logger();
+    ~Logger();
+
+    // Bucle del hilo de fondo
+    void writeLoop();
+
+    // Escribe los mensajes disponibles; devuelve cuántos escribió
+    size_t drain(size_t& dequeuePosition);
+
+public:
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    static Logger& instance();
+
+    // Registrar un mensaje con formato printf
+    void log(LogLevel level, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+    // Nivel mínimo en tiempo de ejecución (no puede bajar del compilado)
+    void setLevel(LogLevel level) { minLevel.store(static_cast<int>(level), std::memory_order_relaxed); }
+    bool isEnabled(LogLevel level) const {
+        return static_cast<int>(level) >= minLevel.load(std::memory_order_relaxed);
+    }
+
+    // Espera a que se escriban todos los mensajes registrados hasta ahora
+    void flush();
+
+    // Convierte "trace", "debug", "info", "warn" o "error" en un nivel
+    static bool parseLevel(const char* name, LogLevel& level);
+
+    // Solo comprueba los argumentos de los mensajes eliminados en compilación
+    __attribute__((format(printf, 1, 2))) static void checkFormat(const char*, ...) {}
+};
+
+#define LOG_AT(level, ...)                                          \
+    do {                                                            \
+        if (Logger::instance().isEnabled(level)) {                  \
+            Logger::instance().log(level, __VA_ARGS__);             \
+        }                                                           \
+    } while (0)
+
+// Mensaje eliminado: se comprueba el formato pero no genera código
+#define LOG_DISCARD(...)                                            \
+    do {                                                            \
+        if constexpr (false) {                                      \
+            Logger::checkFormat(__VA_ARGS__);                       \
+        }                                                           \
+    } while (0)
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_TRACE
+#define LOG_TRACE(...) LOG_AT(LogLevel::TRACE, __VA_ARGS__)
+#else
+#define LOG_TRACE(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) LOG_AT(LogLevel::DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(...) LOG_AT(LogLevel::INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(...) LOG_AT(LogLevel::WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) LOG_AT(LogLevel::ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#endif // LOGGER_H
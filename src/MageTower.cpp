@@ -1,5 +1,5 @@
 #include "MageTower.h"
-#include <iostream>
+#include "Logger.h"
 
 MageTower::MageTower(int r, int c, SDL_Texture* tex) : Tower(r, c, BASE_COST, tex) {
     // Inicializa atributos específicos
@@ -22,14 +22,13 @@ void MageTower::attack() {
     }
     
     // Lógica de ataque normal
-    std::cout << "¡Mago lanza hechizo! Daño: " << damage << std::endl;
+    LOG_DEBUG("¡Mago lanza hechizo! Daño: %d", damage);
 }
 
 void MageTower::performSpecialAttack() {
     // Lógica de ataque especial: explosión mágica (daño en área)
-    std::cout << "¡¡ATAQUE ESPECIAL!! Mago lanza explosión arcana! "
-              << "Daño: " << (damage * 1.5) << " en un radio de " 
-              << AREA_DAMAGE_RADIUS << " píxeles" << std::endl;
+    LOG_DEBUG("¡¡ATAQUE ESPECIAL!! Mago lanza explosión arcana! Daño: %g en un radio de %g píxeles",
+              damage * 1.5, AREA_DAMAGE_RADIUS);
     
     // En una implementación completa, aquí buscaríamos todos los enemigos
     // dentro del radio y les aplicaríamos daño
@@ -18,7 +18,7 @@ public:
     
     // Implementación de métodos virtuales
     void attack() override;
-    std::string getType() const override { return "Mago"; }
+    TowerType getKind() const override { return TowerType::MAGE; }
 
     void performSpecialAttack() override;
 
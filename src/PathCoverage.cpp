@@ -0,0 +1,129 @@
+#include "PathCoverage.h"
+#include <algorithm>
+
+PathCoverage::PathCoverage() : centerX(0), centerY(0), range(-1) {
+}
+
+void PathCoverage::clear() {
+    paths.clear();
+}
+
+PathCoverage::Entry& PathCoverage::getEntry(int pathId, const std::vector<SDL_Point>& path,
+                                            int x, int y, int towerRange, uint32_t pathSerial) {
+    if (x != centerX || y != centerY || towerRange != range) {
+        clear();
+        centerX = x;
+        centerY = y;
+        range = towerRange;
+    }
+
+    if (pathId >= static_cast<int>(paths.size())) {
+        paths.resize(pathId + 1);
+    }
+
+    Entry& entry = paths[pathId];
+    if (!entry.computed || entry.pathSerial != pathSerial) {
+        entry.intervals = compute(path, centerX, centerY, range);
+        entry.kinds = expand(entry.intervals, path.size());
+        entry.computed = true;
+        entry.pathSerial = pathSerial;
+    }
+    return entry;
+}
+
+const std::vector<CoverageInterval>& PathCoverage::getIntervals(int pathId, const std::vector<SDL_Point>& path,
+                                                                int x, int y, int towerRange, uint32_t pathSerial) {
+    return getEntry(pathId, path, x, y, towerRange, pathSerial).intervals;
+}
+
+const std::vector<CoverageKind>& PathCoverage::getKinds(int pathId, const std::vector<SDL_Point>& path,
+                                                        int x, int y, int towerRange, uint32_t pathSerial) {
+    return getEntry(pathId, path, x, y, towerRange, pathSerial).kinds;
+}
+
+// Distancia al cuadrado del punto (px, py) al segmento a-b
+static float segmentDistanceSquared(float px, float py, const SDL_Point& a, const SDL_Point& b) {
+    float abx = static_cast<float>(b.x - a.x);
+    float aby = static_cast<float>(b.y - a.y);
+    float apx = px - a.x;
+    float apy = py - a.y;
+    float lengthSquared = abx*abx + aby*aby;
+
+    float t = 0.0f;
+    if (lengthSquared > 0.0f) {
+        t = std::max(0.0f, std::min(1.0f, (apx*abx + apy*aby) / lengthSquared));
+    }
+
+    float dx = apx - t * abx;
+    float dy = apy - t * aby;
+    return dx*dx + dy*dy;
+}
+
+std::vector<CoverageInterval> PathCoverage::compute(const std::vector<SDL_Point>& path,
+                                                    int centerX, int centerY, int range) {
+    std::vector<CoverageInterval> result;
+
+    float inner = static_cast<float>(std::max(0, range - MARGIN));
+    float outer = static_cast<float>(range + MARGIN);
+    float innerSquared = inner * inner;
+    float outerSquared = outer * outer;
+
+    // El tramo k va de path[k-1] a path[k]; el índice 0 no tiene tramo conocido
+    // (el enemigo aún se dirige al primer punto) y se trata aparte en classify
+    for (int k = 1; k < static_cast<int>(path.size()); k++) {
+        const SDL_Point& a = path[k - 1];
+        const SDL_Point& b = path[k];
+
+        CoverageKind kind;
+        if (segmentDistanceSquared(static_cast<float>(centerX), static_cast<float>(centerY), a, b) > outerSquared) {
+            kind = CoverageKind::OUTSIDE;
+        } else {
+            // El círculo es convexo: si los dos extremos están dentro, todo el tramo lo está
+            float adx = static_cast<float>(a.x - centerX), ady = static_cast<float>(a.y - centerY);
+            float bdx = static_cast<float>(b.x - centerX), bdy = static_cast<float>(b.y - centerY);
+            bool inside = adx*adx + ady*ady <= innerSquared && bdx*bdx + bdy*bdy <= innerSquared;
+            kind = inside ? CoverageKind::INSIDE : CoverageKind::PARTIAL;
+        }
+
+        if (kind == CoverageKind::OUTSIDE) {
+            continue;
+        }
+
+        // Extender el intervalo anterior si es contiguo y del mismo tipo
+        if (!result.empty() && result.back().last == k - 1 && result.back().kind == kind) {
+            result.back().last = k;
+        } else {
+            result.push_back({k, k, kind});
+        }
+    }
+
+    return result;
+}
+
+std::vector<CoverageKind> PathCoverage::expand(const std::vector<CoverageInterval>& intervals, size_t pathCount) {
+    std::vector<CoverageKind> kinds(pathCount, CoverageKind::OUTSIDE);
+    for (const CoverageInterval& interval : intervals) {
+        for (int k = interval.first; k <= interval.last && k < static_cast<int>(pathCount); k++) {
+            kinds[k] = interval.kind;
+        }
+    }
+    return kinds;
+}
+
+CoverageKind PathCoverage::classify(const std::vector<CoverageInterval>& intervals,
+                                    int pathIndex, float stepDistance) {
+    // Sin tramo conocido o demasiado rápido para el margen: distancia real
+    if (pathIndex <= 0 || stepDistance > MARGIN - POSITION_SLACK) {
+        return CoverageKind::PARTIAL;
+    }
+
+    for (const CoverageInterval& interval : intervals) {
+        if (pathIndex < interval.first) {
+            break;
+        }
+        if (pathIndex <= interval.last) {
+            return interval.kind;
+        }
+    }
+    return CoverageKind::OUTSIDE;
+}
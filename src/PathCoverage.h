@@ -0,0 +1,100 @@
+#ifndef PATH_COVERAGE_H
+#define PATH_COVERAGE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Relación entre un tramo del camino y el alcance de una torre
+enum class CoverageKind : uint8_t {
+    OUTSIDE,   // Ningún punto del tramo está al alcance
+    PARTIAL,   // Hay que comprobar la distancia real
+    INSIDE     // Todo el tramo está al alcance
+};
+
+// Índices de camino consecutivos con la misma cobertura (first y last incluidos)
+struct CoverageInterval {
+    int first;
+    int last;
+    CoverageKind kind;
+};
+
+// Cobertura de los caminos por una torre fija. Un enemigo con pathIndex = k
+// avanza por el tramo path[k-1] -> path[k], así que basta con mirar k en una
+// lista corta de intervalos para saber si está al alcance, sin calcular
+// distancias (salvo en los tramos que cruzan el borde del círculo). Los
+// intervalos se expanden además a una tabla por índice para consultarlos en O(1).
+//
+// Los enemigos van sobre el tramo (avanzan por distancia recorrida), pero su
+// posición se trunca a enteros al comprobar el alcance. Por eso los tramos se
+// clasifican con un margen y, si un enemigo avanza más de lo que cubre ese
+// margen en un tick, se comprueba su distancia real.
+class PathCoverage {
+public:
+    // Margen con el que se clasifican los tramos (píxeles)
+    static const int MARGIN = 10;
+    // Desviación máxima respecto al tramo sin contar el avance del tick
+    // (truncado a enteros y redondeo)
+    static const int POSITION_SLACK = 2;
+
+private:
+    int centerX;
+    int centerY;
+    int range;
+
+    // Cobertura de un camino: intervalos y su tabla expandida por pathIndex
+    struct Entry {
+        bool computed = false;
+        uint32_t pathSerial = 0;
+        std::vector<CoverageInterval> intervals;
+        std::vector<CoverageKind> kinds;
+    };
+
+    // Por camino (id en el PathRegistry de EnemyManager)
+    std::vector<Entry> paths;
+
+    Entry& getEntry(int pathId, const std::vector<SDL_Point>& path, int centerX, int centerY, int range,
+                    uint32_t pathSerial);
+
+public:
+    PathCoverage();
+
+    // Intervalos de un camino. Se calculan la primera vez que se piden y se
+    // recalculan todos si cambia el centro o el alcance de la torre (mejora).
+    // pathSerial distingue caminos que reutilizan el mismo id: si no coincide
+    // con el del cálculo guardado, se vuelve a calcular
+    const std::vector<CoverageInterval>& getIntervals(int pathId, const std::vector<SDL_Point>& path,
+                                                      int centerX, int centerY, int range,
+                                                      uint32_t pathSerial = 0);
+
+    // Tabla de cobertura por pathIndex del camino (mismo cálculo que getIntervals)
+    const std::vector<CoverageKind>& getKinds(int pathId, const std::vector<SDL_Point>& path,
+                                              int centerX, int centerY, int range,
+                                              uint32_t pathSerial = 0);
+
+    // Descarta todos los intervalos calculados
+    void clear();
+
+    // Calcula los intervalos de cobertura (sin los tramos OUTSIDE)
+    static std::vector<CoverageInterval> compute(const std::vector<SDL_Point>& path,
+                                                 int centerX, int centerY, int range);
+
+    // Expande los intervalos a una tabla de pathCount entradas (OUTSIDE por defecto)
+    static std::vector<CoverageKind> expand(const std::vector<CoverageInterval>& intervals, size_t pathCount);
+
+    // Cobertura para un enemigo con ese pathIndex que avanza stepDistance píxeles por tick
+    static CoverageKind classify(const std::vector<CoverageInterval>& intervals,
+                                 int pathIndex, float stepDistance);
+    static CoverageKind classify(const std::vector<CoverageKind>& kinds,
+                                 int pathIndex, float stepDistance) {
+        // Sin tramo conocido, fuera del camino o demasiado rápido para el margen: distancia real
+        if (pathIndex <= 0 || pathIndex >= static_cast<int>(kinds.size()) ||
+            stepDistance > MARGIN - POSITION_SLACK) {
+            return CoverageKind::PARTIAL;
+        }
+        return kinds[pathIndex];
+    }
+};
+
+#endif // PATH_COVERAGE_H
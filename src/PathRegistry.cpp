@@ -0,0 +1,69 @@
+#include "PathRegistry.h"
+#include "AStar.h"  // operator== de SDL_Point
+
+PathRegistry::PathRegistry() : nextSerial(1), liveCount(0) {
+}
+
+uint64_t PathRegistry::hashPoints(const std::vector<SDL_Point>& points) {
+    // FNV-1a sobre las coordenadas
+    uint64_t hash = 14695981039346656037ull;
+    for (const SDL_Point& point : points) {
+        hash = (hash ^ static_cast<uint32_t>(point.x)) * 1099511628211ull;
+        hash = (hash ^ static_cast<uint32_t>(point.y)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+int PathRegistry::acquire(std::vector<SDL_Point>&& points, uint32_t boardVersion) {
+    uint64_t hash = hashPoints(points);
+
+    // ¿Ya hay un camino igual?
+    auto range = idsByHash.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        Entry& entry = entries[it->second];
+        if (entry.points == points) {
+            entry.refCount++;
+            return it->second;
+        }
+    }
+
+    int id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<int>(entries.size());
+        entries.emplace_back();
+    }
+
+    Entry& entry = entries[id];
+    entry.points = std::move(points);
+    entry.track.build(entry.points);
+    entry.hash = hash;
+    entry.refCount = 1;
+    entry.serial = nextSerial++;
+    entry.boardVersion = boardVersion;
+    idsByHash.emplace(hash, id);
+    liveCount++;
+    return id;
+}
+
+void PathRegistry::release(int id) {
+    Entry& entry = entries[id];
+    if (entry.refCount == 0 || --entry.refCount > 0) {
+        return;
+    }
+
+    // Última referencia: el id queda libre y se devuelve la memoria del camino
+    auto range = idsByHash.equal_range(entry.hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == id) {
+            idsByHash.erase(it);
+            break;
+        }
+    }
+    std::vector<SDL_Point>().swap(entry.points);
+    entry.track.clear();
+    freeIds.push_back(id);
+    liveCount--;
+}
@@ -0,0 +1,64 @@
+#ifndef PATH_REGISTRY_H
+#define PATH_REGISTRY_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include "PathTrack.h"
+
+// Caminos compartidos por los enemigos. Cada camino distinto se guarda una sola
+// vez (se identifica por su contenido) y los enemigos solo guardan su id y el
+// punto por el que van. Los caminos cuentan sus referencias: los tiene el
+// conjunto de caminos actual de EnemyManager y cada enemigo que los sigue, y al
+// soltar la última se libera su memoria y el id queda para otro camino.
+//
+// Cada camino guarda también su versión por distancia recorrida (PathTrack),
+// que es lo que usan los enemigos para moverse.
+//
+// Como los ids se reutilizan, cada camino lleva además un número de serie único:
+// las cachés indexadas por id (como PathCoverage) lo comparan para saber si el
+// id sigue siendo el mismo camino.
+class PathRegistry {
+private:
+    struct Entry {
+        std::vector<SDL_Point> points;
+        PathTrack track;
+        uint64_t hash = 0;
+        uint32_t refCount = 0;
+        uint32_t serial = 0;
+        uint32_t boardVersion = 0;   // Versión del tablero con la que se creó
+    };
+
+    std::vector<Entry> entries;
+    std::vector<int> freeIds;
+    std::unordered_multimap<uint64_t, int> idsByHash;
+    uint32_t nextSerial;
+    size_t liveCount;
+
+    static uint64_t hashPoints(const std::vector<SDL_Point>& points);
+
+public:
+    PathRegistry();
+
+    // Id del camino con esos puntos (el existente si ya hay uno igual, o uno
+    // nuevo) con una referencia más para quien lo pide
+    int acquire(std::vector<SDL_Point>&& points, uint32_t boardVersion);
+
+    // Otra referencia a un camino existente / soltar una referencia
+    void retain(int id) { entries[id].refCount++; }
+    void release(int id);
+
+    const std::vector<SDL_Point>& get(int id) const { return entries[id].points; }
+    const PathTrack& getTrack(int id) const { return entries[id].track; }
+    uint32_t getSerial(int id) const { return entries[id].serial; }
+    uint32_t getBoardVersion(int id) const { return entries[id].boardVersion; }
+    uint32_t getRefCount(int id) const { return entries[id].refCount; }
+
+    // Ids posibles (para tablas indexadas por id) y caminos vivos
+    size_t getIdCount() const { return entries.size(); }
+    size_t getLiveCount() const { return liveCount; }
+};
+
+#endif // PATH_REGISTRY_H
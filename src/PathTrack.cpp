@@ -0,0 +1,53 @@
+#include "PathTrack.h"
+#include <cmath>
+
+PathTrack::PathTrack() : totalLength(0.0f) {
+}
+
+void PathTrack::clear() {
+    std::vector<PathSegment>().swap(segments);
+    std::vector<float>().swap(pointDistance);
+    totalLength = 0.0f;
+}
+
+void PathTrack::build(const std::vector<SDL_Point>& points) {
+    segments.clear();
+    pointDistance.clear();
+    totalLength = 0.0f;
+    if (points.empty()) {
+        return;
+    }
+
+    pointDistance.reserve(points.size());
+    pointDistance.push_back(0.0f);
+
+    // Paso anterior (para saber si el siguiente sigue la misma recta)
+    int lastDx = 0;
+    int lastDy = 0;
+    for (size_t k = 1; k < points.size(); k++) {
+        int dx = points[k].x - points[k - 1].x;
+        int dy = points[k].y - points[k - 1].y;
+        float length = std::sqrt(static_cast<float>(dx*dx + dy*dy));
+
+        // Alineado con el paso anterior y en el mismo sentido: se alarga el tramo
+        bool collinear = !segments.empty() && dx*lastDy == dy*lastDx && dx*lastDx + dy*lastDy > 0;
+        if (length > 0.0f && !collinear) {
+            segments.push_back({static_cast<float>(points[k - 1].x), static_cast<float>(points[k - 1].y),
+                                dx / length, dy / length, totalLength, 0.0f});
+        }
+        if (length > 0.0f) {
+            segments.back().length += length;
+            lastDx = dx;
+            lastDy = dy;
+        }
+
+        totalLength += length;
+        pointDistance.push_back(totalLength);
+    }
+
+    // Un camino de un solo punto (o de puntos repetidos) es un tramo quieto
+    if (segments.empty()) {
+        segments.push_back({static_cast<float>(points[0].x), static_cast<float>(points[0].y),
+                            0.0f, 0.0f, 0.0f, 0.0f});
+    }
+}
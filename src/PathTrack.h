@@ -0,0 +1,68 @@
+#ifndef PATH_TRACK_H
+#define PATH_TRACK_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cstddef>
+
+// Tramo recto de un camino: los puntos alineados seguidos se unen en uno solo
+struct PathSegment {
+    float startX, startY;   // Punto inicial
+    float dirX, dirY;       // Dirección unitaria
+    float start;            // Distancia recorrida al empezar el tramo
+    float length;
+};
+
+// Camino parametrizado por la distancia recorrida desde su primer punto. Se
+// construye una vez por camino (las raíces cuadradas se calculan aquí) y un
+// enemigo solo necesita esa distancia: su posición es el punto del tramo que
+// la contiene, y los enemigos solo avanzan, así que el tramo se busca desde el
+// del tick anterior.
+//
+// Las distancias negativas quedan antes del primer punto, en la prolongación
+// del primer tramo (enemigos que aún no han llegado a la entrada).
+class PathTrack {
+private:
+    std::vector<PathSegment> segments;
+    std::vector<float> pointDistance;   // Distancia recorrida en cada punto original
+    float totalLength;
+
+public:
+    PathTrack();
+
+    void build(const std::vector<SDL_Point>& points);
+    void clear();
+
+    bool empty() const { return segments.empty(); }
+    float getTotalLength() const { return totalLength; }
+    const std::vector<PathSegment>& getSegments() const { return segments; }
+
+    // Tramo que contiene 'distance', avanzando desde 'segment'
+    int advanceSegment(int segment, float distance) const {
+        int last = static_cast<int>(segments.size()) - 1;
+        while (segment < last && distance >= segments[segment + 1].start) {
+            segment++;
+        }
+        return segment;
+    }
+
+    // Primer punto original por delante de 'distance', avanzando desde 'pointIndex'
+    // (el pathIndex de los enemigos: están entre los puntos pointIndex-1 y pointIndex)
+    int advancePoint(int pointIndex, float distance) const {
+        int count = static_cast<int>(pointDistance.size());
+        while (pointIndex < count && pointDistance[pointIndex] <= distance) {
+            pointIndex++;
+        }
+        return pointIndex;
+    }
+
+    // Posición a esa distancia dentro del tramo 'segment'
+    void positionAt(int segment, float distance, float& x, float& y) const {
+        const PathSegment& s = segments[segment];
+        float along = distance - s.start;
+        x = s.startX + s.dirX * along;
+        y = s.startY + s.dirY * along;
+    }
+};
+
+#endif // PATH_TRACK_H
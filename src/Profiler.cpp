@@ -0,0 +1,133 @@
+#include "Profiler.h"
+#include "Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+const char* const ZONE_NAMES[PROFILE_ZONE_COUNT] = {
+    "Frame",
+    "TowerManager::update",
+    "EnemyManager::update",
+    "EnemyManager::processTowerAttacks",
+    "GameBoard::render",
+    "Tower::render",
+    "EnemyManager::render",
+    "Game::renderUI"
+};
+}
+
+const char* getZoneName(ProfileZone zone) {
+    return ZONE_NAMES[static_cast<int>(zone)];
+}
+
+thread_local bool Profiler::activeOnThread = false;
+
+Profiler::Profiler()
+    : originNs(0), frameCount(0), currentFrame(), frameOpen(false), eventCount(0) {
+}
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+uint64_t Profiler::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::start() {
+    // Los buffers se reservan una sola vez; medir no asigna memoria
+    frames.assign(FRAME_HISTORY, FrameRecord());
+    events.assign(EVENT_CAPACITY, ZoneEvent());
+    frameCount = 0;
+    eventCount = 0;
+    frameOpen = false;
+    originNs = now();
+    activeOnThread = true;
+}
+
+void Profiler::stop() {
+    activeOnThread = false;
+}
+
+void Profiler::beginFrame() {
+    std::memset(&currentFrame, 0, sizeof(currentFrame));
+    currentFrame.index = frameCount;
+    currentFrame.startNs = now();
+    frameOpen = true;
+}
+
+void Profiler::endFrame() {
+    if (!frameOpen) {
+        return;
+    }
+
+    // El propio frame también queda como evento
+    record(ProfileZone::FRAME, currentFrame.startNs, now());
+    currentFrame.durationNs = currentFrame.zoneNs[static_cast<int>(ProfileZone::FRAME)];
+
+    frames[frameCount % FRAME_HISTORY] = currentFrame;
+    frameCount++;
+    frameOpen = false;
+}
+
+void Profiler::record(ProfileZone zone, uint64_t startNs, uint64_t endNs) {
+    uint64_t duration = endNs - startNs;
+
+    // Fuera de un frame no se suma a ninguno (sería el siguiente en abrirse)
+    if (frameOpen) {
+        int z = static_cast<int>(zone);
+        currentFrame.zoneNs[z] += duration;
+        currentFrame.zoneCalls[z]++;
+    }
+
+    // Si el buffer está lleno se sobrescribe el evento más antiguo
+    ZoneEvent& event = events[eventCount % EVENT_CAPACITY];
+    event.startNs = startNs;
+    event.durationNs = duration;
+    event.frame = frameOpen ? frameCount : NO_FRAME;
+    event.zone = zone;
+    eventCount++;
+}
+
+size_t Profiler::getFrameCount() const {
+    return frameCount < FRAME_HISTORY ? static_cast<size_t>(frameCount) : FRAME_HISTORY;
+}
+
+const Profiler::FrameRecord& Profiler::getFrame(size_t age) const {
+    return frames[(frameCount - 1 - age) % FRAME_HISTORY];
+}
+
+bool Profiler::exportChromeTrace(const char* path) const {
+    FILE* file = std::fopen(path, "w");
+    if (!file) {
+        LOG_ERROR("No se pudo escribir la traza en %s", path);
+        return false;
+    }
+
+    // Eventos completos ("ph":"X") en microsegundos desde start(), del más antiguo al más nuevo
+    uint64_t first = eventCount > EVENT_CAPACITY ? eventCount - EVENT_CAPACITY : 0;
+    std::fprintf(file, "{\"traceEvents\":[\n");
+    std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+                       "\"args\":{\"name\":\"GeneticKingdom\"}}");
+    for (uint64_t i = first; i < eventCount; i++) {
+        const ZoneEvent& event = events[i % EVENT_CAPACITY];
+        double ts = (event.startNs - originNs) / 1000.0;
+        double dur = event.durationNs / 1000.0;
+        std::fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                           "\"pid\":1,\"tid\":1,\"args\":{",
+                     getZoneName(event.zone), event.zone == ProfileZone::FRAME ? "frame" : "zone", ts, dur);
+        if (event.frame != NO_FRAME) {
+            std::fprintf(file, "\"frame\":%llu", static_cast<unsigned long long>(event.frame));
+        }
+        std::fprintf(file, "}}");
+    }
+    std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    bool ok = std::fclose(file) == 0;
+    LOG_INFO("Traza de perfilado escrita en %s (%llu eventos)", path,
+             static_cast<unsigned long long>(eventCount - first));
+    return ok;
+}
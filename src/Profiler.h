@@ -0,0 +1,147 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Perfilado compilado (1) o eliminado del binario (0). Se elige con la
+// variable PROFILE del Makefile (por defecto activado). Tras cambiarlo: make clean
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// Zonas medidas (una por subsistema del frame)
+enum class ProfileZone : uint8_t {
+    FRAME,
+    TOWER_UPDATE,
+    ENEMY_UPDATE,
+    TOWER_ATTACKS,
+    BOARD_RENDER,
+    TOWER_RENDER,
+    ENEMY_RENDER,
+    UI_RENDER
+};
+
+constexpr int PROFILE_ZONE_COUNT = 8;
+
+// Nombre de la zona (el que aparece en la traza)
+const char* getZoneName(ProfileZone zone);
+
+// Perfilador de frames: cada zona medida suma su duración al frame en curso y
+// deja un evento en un buffer circular. Al cerrar el frame, sus totales pasan
+// a un historial circular (para la gráfica en pantalla) y los eventos se
+// pueden exportar como JSON trace_event de Chrome (chrome://tracing, Perfetto).
+// Solo mide en el hilo que llamó a start(); en el resto, y con el perfilador
+// parado, una zona cuesta una lectura de una variable thread_local.
+class Profiler {
+public:
+    static const size_t FRAME_HISTORY = 256;     // Frames guardados para la gráfica
+    static const size_t EVENT_CAPACITY = 65536;  // Eventos guardados para la traza
+
+    // Totales de un frame
+    struct FrameRecord {
+        uint64_t index;
+        uint64_t startNs;
+        uint64_t durationNs;
+        uint64_t zoneNs[PROFILE_ZONE_COUNT];
+        uint32_t zoneCalls[PROFILE_ZONE_COUNT];
+    };
+
+private:
+    // Una ejecución de una zona
+    struct ZoneEvent {
+        uint64_t startNs;
+        uint64_t durationNs;
+        uint64_t frame;      // NO_FRAME si se midió fuera de un frame
+        ProfileZone zone;
+    };
+
+    static constexpr uint64_t NO_FRAME = UINT64_MAX;
+
+    static thread_local bool activeOnThread;
+
+    uint64_t originNs;                 // Instante de start(); las trazas empiezan en 0
+    std::vector<FrameRecord> frames;   // Historial circular
+    uint64_t frameCount;               // Frames cerrados desde start()
+    FrameRecord currentFrame;
+    bool frameOpen;
+    std::vector<ZoneEvent> events;     // Buffer circular de eventos
+    uint64_t eventCount;               // Eventos registrados desde start()
+
+    Profiler();
+
+public:
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    static Profiler& instance();
+
+    // Reloj monótono en nanosegundos
+    static uint64_t now();
+
+    // Empieza a medir en el hilo que llama (descarta lo medido antes)
+    void start();
+
+    // Deja de medir (lo medido se conserva para exportarlo)
+    void stop();
+
+    static bool isActive() { return activeOnThread; }
+
+    // Delimitan un frame; las zonas medidas entre ambas se suman a él (las de
+    // fuera de un frame, p.ej. generar caminos o entrenar, solo quedan en la traza)
+    void beginFrame();
+    void endFrame();
+
+    // Registra una ejecución de una zona
+    void record(ProfileZone zone, uint64_t startNs, uint64_t endNs);
+
+    // Frames disponibles en el historial y acceso por antigüedad (0 = el último)
+    size_t getFrameCount() const;
+    const FrameRecord& getFrame(size_t age) const;
+
+    // Escribe los eventos guardados como JSON trace_event de Chrome
+    bool exportChromeTrace(const char* path) const;
+};
+
+// Mide su ámbito como una ejecución de la zona
+class ProfileScope {
+private:
+    ProfileZone zone;
+    bool active;
+    uint64_t startNs;
+
+public:
+    explicit ProfileScope(ProfileZone scopeZone)
+        : zone(scopeZone), active(Profiler::isActive()), startNs(active ? Profiler::now() : 0) {}
+
+    ~ProfileScope() {
+        if (active) {
+            Profiler::instance().record(zone, startNs, Profiler::now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_ZONE(zone) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(zone)
+#define PROFILE_BEGIN_FRAME()                                       \
+    do {                                                            \
+        if (Profiler::isActive()) Profiler::instance().beginFrame();\
+    } while (0)
+#define PROFILE_END_FRAME()                                         \
+    do {                                                            \
+        if (Profiler::isActive()) Profiler::instance().endFrame();  \
+    } while (0)
+#else
+#define PROFILE_ZONE(zone) do {} while (0)
+#define PROFILE_BEGIN_FRAME() do {} while (0)
+#define PROFILE_END_FRAME() do {} while (0)
+#endif
+
+#endif // PROFILER_H
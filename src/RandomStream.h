@@ -0,0 +1,74 @@
+#ifndef RANDOM_STREAM_H
+#define RANDOM_STREAM_H
+
+#include <cstdint>
+#include <random>
+
+// Identificadores de los flujos aleatorios de cada subsistema.
+// Todos derivan de la misma semilla de sesión, así una partida se puede
+// reproducir completa a partir de un único número de 64 bits.
+enum class RngStreamId : uint64_t {
+    GENETIC_ALGORITHM = 1,
+    ENEMY_MANAGER = 2,
+    TOWERS = 3,
+    FITNESS_EVALUATION = 4,
+    ISLANDS = 5
+};
+
+// Generador basado en contador (estilo SplitMix64): cada número es un hash
+// de (clave, contador), así que crear un flujo es gratis y no hay lecturas
+// de std::random_device en el bucle del juego.
+// Cumple UniformRandomBitGenerator, pero para que los resultados no dependan
+// de la implementación de la biblioteca estándar se usan nextFloat/nextInt.
+class RandomStream {
+private:
+    uint64_t key;
+    uint64_t counter;
+
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+    // Función de mezcla de SplitMix64
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+public:
+    using result_type = uint64_t;
+
+    explicit RandomStream(uint64_t seed = 0, uint64_t streamId = 0)
+        : key(mix(seed + GOLDEN_GAMMA * (mix(streamId) | 1))), counter(0) {}
+
+    // Flujo para un subsistema (y opcionalmente un índice dentro de él, p.ej. una torre)
+    static RandomStream forSubsystem(uint64_t seed, RngStreamId id, uint64_t index = 0) {
+        return RandomStream(seed, (static_cast<uint64_t>(id) << 32) ^ index);
+    }
+
+    // Semilla no determinista para iniciar una sesión (una sola lectura del dispositivo)
+    static uint64_t randomSeed() {
+        std::random_device rd;
+        return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()() {
+        return mix(key + GOLDEN_GAMMA * ++counter);
+    }
+
+    // Número real uniforme en [0, 1)
+    float nextFloat() {
+        return static_cast<float>((*this)() >> 40) * (1.0f / 16777216.0f);
+    }
+
+    // Entero uniforme en [low, high] (ambos incluidos)
+    int nextInt(int low, int high) {
+        if (high <= low) return low;
+        uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(high) - low) + 1;
+        return low + static_cast<int>((((*this)() >> 32) * range) >> 32);
+    }
+};
+
+#endif // RANDOM_STREAM_H
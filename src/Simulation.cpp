@@ -0,0 +1,142 @@
+#include "Simulation.h"
+#include "FitnessEvaluator.h"
+#include "IslandModel.h"
+#include "Profiler.h"
+
+Simulation::Simulation(SDL_Renderer* renderer, int rows, int cols, int initialGold, uint64_t sessionSeed)
+    : seed(sessionSeed) {
+    // Crear tablero
+    board = new GameBoard(rows, cols);
+
+    // Crear sistema de recursos
+    resources = new ResourceSystem(initialGold);
+
+    // Crear gestores (sin renderer no se cargan texturas)
+    towerManager = new TowerManager(resources, renderer, seed);
+    enemyManager = new EnemyManager(board, resources, renderer, seed);
+}
+
+Simulation::Simulation(const GameBoard& boardSnapshot, const std::vector<TowerPlacement>& layout,
+                       uint64_t sessionSeed)
+    : seed(sessionSeed) {
+    // Se construye una por genoma evaluado: los mensajes de construcción de
+    // los subsistemas (población inicial, caminos, torres) son de nivel DEBUG
+    // para que el entrenamiento no quede limitado por la salida del logger
+
+    // Copiar el tablero (ya incluye las celdas ocupadas por torres)
+    board = new GameBoard(boardSnapshot);
+    resources = new ResourceSystem(0);
+
+    // Reconstruir las torres sin texturas
+    towerManager = new TowerManager(resources, nullptr, seed);
+    for (const TowerPlacement& placement : layout) {
+        towerManager->addTower(placement.type, placement.row, placement.col, placement.level);
+    }
+
+    enemyManager = new EnemyManager(board, resources, nullptr, seed);
+}
+
+Simulation::~Simulation() {
+    delete enemyManager;
+    delete towerManager;
+    delete resources;
+    delete board;
+}
+
+void Simulation::update(int deltaTime, Game* game) {
+    // Actualizar torres
+    towerManager->update(deltaTime);
+
+    // Actualizar enemigos
+    enemyManager->update(deltaTime);
+
+    // Procesar ataques (game solo se usa para los mensajes en pantalla)
+    enemyManager->processTowerAttacks(towerManager->getTowers(), game);
+}
+
+long Simulation::runWaves(int waves, int stepMs) {
+    int targetWave = enemyManager->getCurrentWave() + waves;
+    long steps = 0;
+
+    // Avanzar hasta lanzar la última oleada y, después, hasta que sus enemigos
+    // mueran o crucen el puente (si llega otra oleada antes, terminamos)
+    while (enemyManager->getCurrentWave() < targetWave ||
+           (enemyManager->getCurrentWave() == targetWave && enemyManager->getEnemyCount() > 0)) {
+        // Sin ventana, cada paso cuenta como un frame para el perfilador
+        PROFILE_BEGIN_FRAME();
+        update(stepMs);
+        PROFILE_END_FRAME();
+        steps++;
+    }
+
+    return steps;
+}
+
+bool Simulation::placeTower(TowerType type, int row, int col, int level) {
+    if (!board->isValidTowerPosition(row, col)) {
+        return false;
+    }
+
+    if (!towerManager->addTower(type, row, col, level)) {
+        return false;
+    }
+
+    board->placeTower(row, col);
+    enemyManager->generatePaths(board);
+    return true;
+}
+
+float Simulation::evaluateGenome(const Genome& genome, int maxTimeMs, int stepMs) {
+    // Sin oleadas: solo el enemigo del genoma
+    enemyManager->setAutoWaves(false);
+    enemyManager->clearEnemies();
+
+    EnemyHandle enemy = enemyManager->spawnEnemyFromGenome(genome);
+    if (enemy == NO_ENEMY) {
+        return 0.0f;
+    }
+
+    // El registro de rendimiento se conserva aunque el enemigo se elimine
+    for (int elapsed = 0; elapsed < maxTimeMs && enemyManager->getEnemyCount() > 0; elapsed += stepMs) {
+        update(stepMs);
+    }
+
+    return enemyManager->getEnemyFitness(enemy);
+}
+
+void Simulation::trainGenerations(FitnessEvaluator& evaluator, int generations) {
+    GeneticAlgorithm& geneticAlgorithm = enemyManager->getGeneticAlgorithm();
+    std::vector<TowerPlacement> layout = towerManager->getLayout();
+
+    // Semilla distinta por generación, derivada de la semilla de sesión
+    auto generationSeed = [this, &geneticAlgorithm] {
+        return RandomStream::forSubsystem(
+            seed, RngStreamId::FITNESS_EVALUATION, static_cast<uint64_t>(geneticAlgorithm.getGeneration()))();
+    };
+
+    for (int i = 0; i < generations; i++) {
+        evaluator.evaluate(geneticAlgorithm.getPopulationRef(), *board, layout, generationSeed());
+        geneticAlgorithm.evolve();
+    }
+
+    // Los hijos de la última evolve() aún no tienen fitness: se evalúan para
+    // que las estadísticas (y los enemigos que se lancen) usen el real
+    if (generations > 0) {
+        evaluator.evaluate(geneticAlgorithm.getPopulationRef(), *board, layout, generationSeed());
+        geneticAlgorithm.updateStatistics();
+    }
+}
+
+void Simulation::trainIslands(FitnessEvaluator& evaluator, IslandModel& islands, int generations) {
+    std::vector<TowerPlacement> layout = towerManager->getLayout();
+    const GameBoard& boardRef = *board;
+
+    // Todas las islas comparten el mismo grupo de hilos de evaluación
+    islands.runGenerations(generations, [&evaluator, &boardRef, &layout](std::vector<Genome>& population, uint64_t evaluationSeed) {
+        evaluator.evaluate(population, boardRef, layout, evaluationSeed);
+    });
+
+    GeneticAlgorithm& geneticAlgorithm = enemyManager->getGeneticAlgorithm();
+    int populationSize = static_cast<int>(geneticAlgorithm.getPopulation().size());
+    geneticAlgorithm.replaceWorst(islands.getTopGenomes(populationSize));
+}
@@ -0,0 +1,78 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+#include "GameBoard.h"
+#include "ResourceSystem.h"
+#include "TowerManager.h"
+#include "EnemyManager.h"
+
+class Game;  // Forward declaration para los mensajes de ataque
+class FitnessEvaluator;
+class IslandModel;
+
+// Lógica del juego (tablero, recursos, torres, enemigos y algoritmo genético)
+// separada de la ventana. Si se construye sin renderer no se cargan texturas
+// y puede ejecutarse sin subsistema de video (modo headless).
+class Simulation {
+private:
+    GameBoard* board;
+    ResourceSystem* resources;
+    TowerManager* towerManager;
+    EnemyManager* enemyManager;
+
+    // Semilla de la sesión: todos los flujos aleatorios derivan de ella
+    uint64_t seed;
+
+public:
+    // Duración por defecto de un tick de simulación (ms)
+    static const int DEFAULT_TICK_MS = 16;
+
+    Simulation(SDL_Renderer* renderer = nullptr, int rows = 12, int cols = 16, int initialGold = 100,
+               uint64_t seed = 0);
+
+    // Copia aislada (headless) de un tablero y una disposición de torres existentes
+    Simulation(const GameBoard& boardSnapshot, const std::vector<TowerPlacement>& layout,
+               uint64_t seed = 0);
+    ~Simulation();
+
+    // La simulación es dueña de sus subsistemas: no se copia
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // Avanza la lógica deltaTime milisegundos (game puede ser nullptr en headless).
+    // Se llama siempre con un tick fijo para que la simulación sea reproducible.
+    void update(int deltaTime, Game* game = nullptr);
+
+    // Ejecuta oleadas completas sin renderizar ni esperar al reloj real.
+    // Devuelve el número de pasos de simulación ejecutados.
+    long runWaves(int waves, int stepMs = DEFAULT_TICK_MS);
+
+    // Colocar una torre sin cobrar oro y regenerar los caminos
+    bool placeTower(TowerType type, int row, int col, int level = 1);
+
+    // Simula un único enemigo creado a partir del genoma (sin oleadas) hasta que
+    // muere, cruza el puente o se agota maxTimeMs, y devuelve su fitness
+    float evaluateGenome(const Genome& genome, int maxTimeMs, int stepMs = DEFAULT_TICK_MS);
+
+    // Entrena el algoritmo genético: en cada generación evalúa toda la población
+    // contra el tablero y las torres actuales (en paralelo) y después evoluciona
+    void trainGenerations(FitnessEvaluator& evaluator, int generations);
+
+    // Igual, pero con varias islas evolucionando a la vez; al terminar, los
+    // mejores genomas de todas las islas pasan a la población de los enemigos
+    void trainIslands(FitnessEvaluator& evaluator, IslandModel& islands, int generations);
+
+    // Semilla con la que se puede repetir la partida
+    uint64_t getSeed() const { return seed; }
+
+    // Acceso a los subsistemas
+    GameBoard* getBoard() const { return board; }
+    ResourceSystem* getResources() const { return resources; }
+    TowerManager* getTowerManager() const { return towerManager; }
+    EnemyManager* getEnemyManager() const { return enemyManager; }
+};
+
+#endif // SIMULATION_H
@@ -0,0 +1,60 @@
+#include "SpatialHash.h"
+#include <algorithm>
+
+SpatialHash::SpatialHash(int rows, int cols, int cellSize)
+    : rows(std::max(1, rows)), cols(std::max(1, cols)), cellSize(std::max(1, cellSize)) {
+    cellStart.assign(this->rows * this->cols + 1, 0);
+}
+
+int SpatialHash::cellIndex(float x, float y) const {
+    int col = static_cast<int>(x) / cellSize;
+    int row = static_cast<int>(y) / cellSize;
+    if (x < 0) col = 0;
+    if (y < 0) row = 0;
+    col = std::min(col, cols - 1);
+    row = std::min(row, rows - 1);
+    return row * cols + col;
+}
+
+void SpatialHash::rebuild(const std::vector<float>& x, const std::vector<float>& y) {
+    size_t count = x.size();
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    entryCell.resize(count);
+    entries.resize(count);
+
+    // Contar enemigos por celda
+    for (size_t i = 0; i < count; i++) {
+        int cell = cellIndex(x[i], y[i]);
+        entryCell[i] = static_cast<uint32_t>(cell);
+        cellStart[cell + 1]++;
+    }
+
+    // Suma de prefijos: posición inicial de cada celda
+    for (size_t c = 1; c < cellStart.size(); c++) {
+        cellStart[c] += cellStart[c - 1];
+    }
+
+    // Colocar cada enemigo en su celda (recorrido en orden: cada celda queda ordenada)
+    cellCursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (size_t i = 0; i < count; i++) {
+        entries[cellCursor[entryCell[i]]++] = static_cast<uint32_t>(i);
+    }
+}
+
+void SpatialHash::queryCircle(float centerX, float centerY, float radius, std::vector<uint32_t>& out) const {
+    int minCell = cellIndex(centerX - radius, centerY - radius);
+    int maxCell = cellIndex(centerX + radius, centerY + radius);
+    int minRow = minCell / cols, minCol = minCell % cols;
+    int maxRow = maxCell / cols, maxCol = maxCell % cols;
+
+    size_t first = out.size();
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int col = minCol; col <= maxCol; col++) {
+            int cell = row * cols + col;
+            out.insert(out.end(), entries.begin() + cellStart[cell], entries.begin() + cellStart[cell + 1]);
+        }
+    }
+
+    // Mismo orden que un recorrido lineal de los enemigos
+    std::sort(out.begin() + first, out.end());
+}
@@ -0,0 +1,37 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include <vector>
+#include <cstdint>
+
+// Rejilla uniforme para localizar enemigos por celda del tablero (50 px).
+// Se reconstruye en cada tick con un recuento por celdas (O(n)), y cada torre
+// solo consulta las celdas que cubren su círculo de alcance. Los enemigos fuera
+// del tablero se asignan a la celda del borde más cercana, así que las consultas
+// que sobresalen del tablero también los encuentran.
+class SpatialHash {
+private:
+    int rows;
+    int cols;
+    int cellSize;
+
+    std::vector<uint32_t> cellStart;   // Inicio de cada celda en 'entries' (rows*cols + 1)
+    std::vector<uint32_t> entries;     // Índices de enemigos ordenados por celda
+    std::vector<uint32_t> entryCell;   // Celda de cada enemigo (temporal de la reconstrucción)
+    std::vector<uint32_t> cellCursor;  // Siguiente posición libre de cada celda (temporal)
+
+    int cellIndex(float x, float y) const;
+
+public:
+    SpatialHash(int rows, int cols, int cellSize);
+
+    // Reconstruye la rejilla con las posiciones actuales (x[i], y[i])
+    void rebuild(const std::vector<float>& x, const std::vector<float>& y);
+
+    // Añade a 'out' los índices de los enemigos de las celdas que tocan el
+    // círculo (centerX, centerY, radius), en orden creciente de índice.
+    // El llamador comprueba la distancia exacta.
+    void queryCircle(float centerX, float centerY, float radius, std::vector<uint32_t>& out) const;
+};
+
+#endif // SPATIAL_HASH_H
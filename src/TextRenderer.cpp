@@ -0,0 +1,183 @@
+#include "TextRenderer.h"
+#include "Logger.h"
+#include <algorithm>
+
+TextRenderer::TextRenderer()
+    : renderer(nullptr), font(nullptr), atlas(nullptr), lineHeight(0), useCounter(0) {
+}
+
+TextRenderer::~TextRenderer() {
+    clear();
+}
+
+bool TextRenderer::initialize(SDL_Renderer* targetRenderer, TTF_Font* textFont) {
+    clear();
+    renderer = targetRenderer;
+    font = textFont;
+    if (!renderer || !font) {
+        return false;
+    }
+    return buildAtlas();
+}
+
+void TextRenderer::clear() {
+    if (atlas) {
+        SDL_DestroyTexture(atlas);
+        atlas = nullptr;
+    }
+    for (auto& entry : cache) {
+        SDL_DestroyTexture(entry.second.texture);
+    }
+    cache.clear();
+}
+
+bool TextRenderer::buildAtlas() {
+    // Cada glifo se renderiza como un texto de un carácter, así queda colocado
+    // igual que dentro de una línea (misma altura y línea base)
+    const SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* glyphs[GLYPH_COUNT] = {};
+    int cellWidth = 1;
+    int cellHeight = TTF_FontHeight(font);
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        char text[2] = {static_cast<char>(FIRST_GLYPH + i), '\0'};
+        glyphs[i] = TTF_RenderText_Blended(font, text, white);
+        int minX, maxX, minY, maxY, advance;
+        if (TTF_GlyphMetrics(font, static_cast<Uint16>(FIRST_GLYPH + i), &minX, &maxX, &minY, &maxY, &advance) != 0) {
+            advance = glyphs[i] ? glyphs[i]->w : 0;
+        }
+        glyphAdvance[i] = advance;
+        if (glyphs[i]) {
+            cellWidth = std::max(cellWidth, glyphs[i]->w);
+            cellHeight = std::max(cellHeight, glyphs[i]->h);
+        }
+    }
+    lineHeight = cellHeight;
+
+    // Rejilla de ATLAS_COLUMNS glifos por fila
+    int atlasRows = (GLYPH_COUNT + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, cellWidth * ATLAS_COLUMNS, cellHeight * atlasRows,
+                                                          32, SDL_PIXELFORMAT_RGBA32);
+    if (surface) {
+        for (int i = 0; i < GLYPH_COUNT; i++) {
+            SDL_Rect cell = {(i % ATLAS_COLUMNS) * cellWidth, (i / ATLAS_COLUMNS) * cellHeight, 0, 0};
+            glyphRects[i] = cell;
+            if (glyphs[i]) {
+                // Copiar también el alfa (sin mezclar con el fondo transparente)
+                SDL_SetSurfaceBlendMode(glyphs[i], SDL_BLENDMODE_NONE);
+                SDL_BlitSurface(glyphs[i], nullptr, surface, &cell);
+                glyphRects[i].w = glyphs[i]->w;
+                glyphRects[i].h = glyphs[i]->h;
+            }
+        }
+        atlas = SDL_CreateTextureFromSurface(renderer, surface);
+        if (atlas) {
+            SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+        }
+        SDL_FreeSurface(surface);
+    }
+
+    for (SDL_Surface* glyph : glyphs) {
+        if (glyph) SDL_FreeSurface(glyph);
+    }
+
+    if (!atlas) {
+        LOG_ERROR("No se pudo crear el atlas de glifos (se usará solo la caché de textos): %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+bool TextRenderer::fitsAtlas(const std::string& text) const {
+    for (char c : text) {
+        unsigned char code = static_cast<unsigned char>(c);
+        if (code < FIRST_GLYPH || code > LAST_GLYPH) {
+            return false;
+        }
+    }
+    return atlas != nullptr;
+}
+
+void TextRenderer::evictOldest() {
+    auto oldest = cache.begin();
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+        if (it->second.lastUse < oldest->second.lastUse) {
+            oldest = it;
+        }
+    }
+    if (oldest != cache.end()) {
+        SDL_DestroyTexture(oldest->second.texture);
+        cache.erase(oldest);
+    }
+}
+
+const TextRenderer::CachedText* TextRenderer::getCachedText(const std::string& text) {
+    auto it = cache.find(text);
+    if (it != cache.end()) {
+        it->second.lastUse = ++useCounter;
+        return &it->second;
+    }
+
+    // Primera vez: se renderiza en blanco (el color se aplica al dibujar)
+    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), {255, 255, 255, 255});
+    if (!surface) {
+        return nullptr;
+    }
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    CachedText entry = {texture, surface->w, surface->h, ++useCounter};
+    SDL_FreeSurface(surface);
+    if (!texture) {
+        return nullptr;
+    }
+
+    if (cache.size() >= MAX_CACHED_TEXTS) {
+        evictOldest();
+    }
+    return &cache.emplace(text, entry).first->second;
+}
+
+SDL_Point TextRenderer::measure(const std::string& text) {
+    if (!font) {
+        return {0, 0};
+    }
+    if (fitsAtlas(text)) {
+        int width = 0;
+        for (char c : text) {
+            width += glyphAdvance[static_cast<unsigned char>(c) - FIRST_GLYPH];
+        }
+        return {width, lineHeight};
+    }
+    const CachedText* cached = getCachedText(text);
+    return cached ? SDL_Point{cached->w, cached->h} : SDL_Point{0, 0};
+}
+
+SDL_Point TextRenderer::draw(const std::string& text, int x, int y, const SDL_Color& color) {
+    if (!font) {
+        return {0, 0};
+    }
+
+    if (fitsAtlas(text)) {
+        SDL_SetTextureColorMod(atlas, color.r, color.g, color.b);
+        SDL_SetTextureAlphaMod(atlas, color.a);
+        int penX = x;
+        for (char c : text) {
+            int glyph = static_cast<unsigned char>(c) - FIRST_GLYPH;
+            const SDL_Rect& source = glyphRects[glyph];
+            if (source.w > 0) {
+                SDL_Rect dest = {penX, y, source.w, source.h};
+                SDL_RenderCopy(renderer, atlas, &source, &dest);
+            }
+            penX += glyphAdvance[glyph];
+        }
+        return {penX - x, lineHeight};
+    }
+
+    const CachedText* cached = getCachedText(text);
+    if (!cached) {
+        return {0, 0};
+    }
+    SDL_SetTextureColorMod(cached->texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(cached->texture, color.a);
+    SDL_Rect dest = {x, y, cached->w, cached->h};
+    SDL_RenderCopy(renderer, cached->texture, nullptr, &dest);
+    return {cached->w, cached->h};
+}
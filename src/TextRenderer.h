@@ -0,0 +1,74 @@
+#ifndef TEXT_RENDERER_H
+#define TEXT_RENDERER_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+// Texto de la interfaz sin crear superficies ni texturas en cada frame.
+//
+// - Atlas de glifos: los caracteres ASCII imprimibles se dibujan una sola vez
+//   (en blanco) en una textura; un texto que solo usa esos caracteres son unos
+//   cuantos rectángulos copiados del atlas, con el color aplicado al copiar.
+//   Es el caso del oro, la oleada y las estadísticas genéticas.
+// - Caché por contenido: el resto de textos (los mensajes de ataque llevan
+//   "¡" y flechas) se renderizan enteros la primera vez y se guarda la textura;
+//   al llenarse se descarta la usada hace más tiempo.
+class TextRenderer {
+private:
+    static const int FIRST_GLYPH = 32;    // ' '
+    static const int LAST_GLYPH = 126;    // '~'
+    static const int GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+    static const int ATLAS_COLUMNS = 16;
+    static const size_t MAX_CACHED_TEXTS = 64;
+
+    SDL_Renderer* renderer;
+    TTF_Font* font;
+
+    // Atlas: rectángulo de cada glifo en la textura y avance horizontal
+    SDL_Texture* atlas;
+    SDL_Rect glyphRects[GLYPH_COUNT];
+    int glyphAdvance[GLYPH_COUNT];
+    int lineHeight;
+
+    // Textos fuera del atlas, renderizados en blanco
+    struct CachedText {
+        SDL_Texture* texture;
+        int w, h;
+        uint64_t lastUse;
+    };
+    std::unordered_map<std::string, CachedText> cache;
+    uint64_t useCounter;
+
+    bool buildAtlas();
+    bool fitsAtlas(const std::string& text) const;
+    const CachedText* getCachedText(const std::string& text);
+    void evictOldest();
+
+public:
+    TextRenderer();
+    ~TextRenderer();
+
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    // Construye el atlas con la fuente. Devuelve false sin renderer o sin fuente
+    // (no se dibujará texto) o si falla el atlas: entonces todos los textos se
+    // renderizan enteros y pasan por la caché
+    bool initialize(SDL_Renderer* targetRenderer, TTF_Font* textFont);
+
+    // Libera el atlas y la caché (antes de cerrar la fuente y el renderer)
+    void clear();
+
+    // Tamaño que ocupará el texto (w, h)
+    SDL_Point measure(const std::string& text);
+
+    // Dibuja el texto con la esquina superior izquierda en (x, y); devuelve su tamaño
+    SDL_Point draw(const std::string& text, int x, int y, const SDL_Color& color);
+
+    size_t getCachedTextCount() const { return cache.size(); }
+};
+
+#endif // TEXT_RENDERER_H
@@ -1,6 +1,5 @@
 #include "Tower.h"
-#include <random>
-#include <iostream>
+#include "Profiler.h"
 
 Tower::Tower(int r, int c, int initialCost, SDL_Texture* tex) 
     : level(1), row(r), col(c), cost(initialCost), upgradeCost(initialCost/2),
@@ -14,6 +13,8 @@ Tower::~Tower() {
 }
 
 void Tower::render(SDL_Renderer* renderer, int gridSize) const {
+    PROFILE_ZONE(ProfileZone::TOWER_RENDER);
+
     // Dibujar la torre usando la textura si está disponible
     if (texture) {
         SDL_Rect destRect = {col * gridSize, row * gridSize, gridSize, gridSize};
@@ -85,6 +86,7 @@ bool Tower::upgrade() {
     level++;
     damage += damage * 0.3; // 30% más de daño
     range += 10; // Aumenta ligeramente el alcance
+    pathCoverage.clear(); // Los tramos al alcance cambian con el nuevo rango
     attackSpeed -= attackSpeed * 0.1; // 10% más rápido
     
     // Mejorar ataque especial
@@ -100,7 +102,7 @@ int Tower::getUpgradeCost() const {
 }
 
 std::string Tower::getTypeString() const {
-    return getType() + " Nivel " + std::to_string(level);
+    return std::string(getType()) + " Nivel " + std::to_string(level);
 }
 
 
@@ -109,11 +111,7 @@ bool Tower::trySpecialAttack() {
     // Actualizar temporizador de ataque especial
     if (specialAttackTimer >= specialCooldown) {
         // Verificar probabilidad
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-        
-        if (dist(gen) < specialAttackProbability) {
+        if (rng.nextFloat() < specialAttackProbability) {
             // Activar ataque especial
             specialAttackReady = true;
             return true;
@@ -4,9 +4,10 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <string>
-#include <iostream>  // For std::cout and std::endl
+#include "RandomStream.h"
+#include "PathCoverage.h"
+#include "CombatTypes.h"
 
-class Enemy;  // This tells the compiler "Enemy is a class that will be defined elsewhere"
 
 
 // Clase base abstracta para todas las torres
@@ -34,6 +35,12 @@ protected:
     float specialAttackProbability;  // Probabilidad de ataque especial (0.0-1.0)
     int specialAttackTimer;         // Temporizador para el ataque especial
     bool specialAttackReady;        // Indica si el ataque especial está listo
+    
+    // Flujo aleatorio propio de la torre (lo asigna TowerManager a partir de la semilla)
+    RandomStream rng;
+    
+    // Tramos de cada camino que quedan al alcance de la torre
+    PathCoverage pathCoverage;
 
 public:
     Tower(int r, int c, int initialCost, SDL_Texture* tex);
@@ -74,13 +81,23 @@ public:
     std::string getTypeString() const;
     
     // Método virtual para obtener el tipo específico
-    virtual std::string getType() const = 0;
+    virtual TowerType getKind() const = 0;
+    
+    // Nombre del tipo (solo para mostrar) y tipo de daño que hace
+    const char* getType() const { return getTowerKind(getKind()).name; }
+    DamageType getDamageType() const { return getTowerKind(getKind()).damageType; }
 
 
     // Métodos para ataques especiales
     virtual bool trySpecialAttack();
     virtual void performSpecialAttack() = 0;  // Método virtual puro
     
+    // Cobertura de los caminos (la usa EnemyManager para elegir objetivos)
+    PathCoverage& getPathCoverage() { return pathCoverage; }
+    
+    // Asignar el flujo aleatorio de la torre
+    void setRandomStream(const RandomStream& stream) { rng = stream; }
+    
     // Getters para ataques especiales
     float getSpecialAttackProbability() const { return specialAttackProbability; }
     bool isSpecialAttackReady() const { return specialAttackReady; }
@@ -2,13 +2,17 @@
 #include "ArcherTower.h"
 #include "MageTower.h"
 #include "ArtilleryTower.h"
-#include <iostream>
+#include "Logger.h"
+#include "Profiler.h"
 
-TowerManager::TowerManager(ResourceSystem* res, SDL_Renderer* renderer) 
+TowerManager::TowerManager(ResourceSystem* res, SDL_Renderer* renderer, uint64_t sessionSeed) 
     : selectedType(TowerType::NONE), selectedTower(nullptr), resources(res),
+      seed(sessionSeed), towersCreated(0),
       archerTexture(nullptr), mageTexture(nullptr), artilleryTexture(nullptr) {
-    // Cargar texturas
-    loadTextures(renderer);
+    // Cargar texturas (sin renderer, modo headless, se usan los colores de respaldo)
+    if (renderer) {
+        loadTextures(renderer);
+    }
 }
 
 TowerManager::~TowerManager() {
@@ -22,7 +26,7 @@ bool TowerManager::loadTextures(SDL_Renderer* renderer) {
     // Cargar las imágenes y escalarlas
     SDL_Surface* surface = IMG_Load("images/arquero.png");
     if (!surface) {
-        std::cerr << "No se pudo cargar la imagen arquero.png: " << IMG_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la imagen arquero.png: %s", IMG_GetError());
         return false;
     }
     archerTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -30,7 +34,7 @@ bool TowerManager::loadTextures(SDL_Renderer* renderer) {
     
     surface = IMG_Load("images/mago.png");
     if (!surface) {
-        std::cerr << "No se pudo cargar la imagen mago.png: " << IMG_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la imagen mago.png: %s", IMG_GetError());
         return false;
     }
     mageTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -38,7 +42,7 @@ bool TowerManager::loadTextures(SDL_Renderer* renderer) {
     
     surface = IMG_Load("images/artillero.png");
     if (!surface) {
-        std::cerr << "No se pudo cargar la imagen artillero.png: " << IMG_GetError() << std::endl;
+        LOG_ERROR("No se pudo cargar la imagen artillero.png: %s", IMG_GetError());
         return false;
     }
     artilleryTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -71,12 +75,16 @@ bool TowerManager::createTower(int row, int col) {
     
     // Verificar si hay suficiente oro
     if (!resources->spendGold(cost)) {
-        std::cout << "¡No hay suficiente oro para esta torre!" << std::endl;
+        LOG_INFO("¡No hay suficiente oro para esta torre!");
         return false;
     }
     
     // Crear la torre del tipo seleccionado
-    switch (selectedType) {
+    return addTower(selectedType, row, col);
+}
+
+bool TowerManager::addTower(TowerType type, int row, int col, int level) {
+    switch (type) {
         case TowerType::ARCHER:
             towers.push_back(std::make_unique<ArcherTower>(row, col, archerTexture));
             break;
@@ -90,11 +98,38 @@ bool TowerManager::createTower(int row, int col) {
             return false;
     }
     
-    std::cout << "Torre creada: " << towers.back()->getType() << std::endl;
+    // Asignar un flujo aleatorio propio según el orden de creación
+    towers.back()->setRandomStream(
+        RandomStream::forSubsystem(seed, RngStreamId::TOWERS, towersCreated++));
+    
+    // Aplicar las mejoras hasta el nivel pedido
+    while (towers.back()->getLevel() < level && towers.back()->upgrade()) {
+    }
+    
+    LOG_DEBUG("Torre creada: %s", towers.back()->getType());
     return true;
 }
 
+std::vector<TowerPlacement> TowerManager::getLayout() const {
+    std::vector<TowerPlacement> layout;
+    layout.reserve(towers.size());
+    
+    for (const auto& tower : towers) {
+        TowerPlacement placement;
+        placement.row = tower->getRow();
+        placement.col = tower->getCol();
+        placement.level = tower->getLevel();
+        
+        placement.type = tower->getKind();
+        layout.push_back(placement);
+    }
+    
+    return layout;
+}
+
 void TowerManager::update(int deltaTime) {
+    PROFILE_ZONE(ProfileZone::TOWER_UPDATE);
+    
     // Actualizar todas las torres
     for (auto& tower : towers) {
         tower->update(deltaTime);
@@ -127,16 +162,16 @@ void TowerManager::render(SDL_Renderer* renderer, int gridSize) const {
                 
                 // Mostrar información sobre la torre
                 // (En una versión más avanzada, esto sería texto renderizado)
-                std::cout << "Torre seleccionada: " << tower->getTypeString() << std::endl;
-                std::cout << "Daño: " << tower->getDamage() << std::endl;
-                std::cout << "Alcance: " << tower->getRange() << std::endl;
-                std::cout << "Velocidad: " << tower->getAttackSpeed() << "ms" << std::endl;
+                LOG_INFO("Torre seleccionada: %s", tower->getTypeString().c_str());
+                LOG_INFO("Daño: %d", tower->getDamage());
+                LOG_INFO("Alcance: %d", tower->getRange());
+                LOG_INFO("Velocidad: %dms", tower->getAttackSpeed());
                 
                 // Mostrar costo de mejora si no está al nivel máximo
                 if (tower->getLevel() < 3) {
-                    std::cout << "Costo de mejora: " << tower->getUpgradeCost() << " oro" << std::endl;
+                    LOG_INFO("Costo de mejora: %d oro", tower->getUpgradeCost());
                 } else {
-                    std::cout << "Nivel máximo alcanzado" << std::endl;
+                    LOG_INFO("Nivel máximo alcanzado");
                 }
                 
                 break;
@@ -222,7 +257,7 @@ void TowerManager::renderTowerMenu(SDL_Renderer* renderer) const {
         if (selectedTower->getLevel() < 3) {
             // Aquí se podría añadir texto renderizado con el costo
             // Por ahora solo mostramos en consola
-            std::cout << "Costo de mejora: " << selectedTower->getUpgradeCost() << " oro" << std::endl;
+            LOG_DEBUG("Costo de mejora: %d oro", selectedTower->getUpgradeCost());
         } else {
             // Indicar nivel máximo con una X
             SDL_RenderDrawLine(renderer, 135, 15, 155, 35);
@@ -231,28 +266,13 @@ void TowerManager::renderTowerMenu(SDL_Renderer* renderer) const {
     }
     
     // Mostrar precios (esto sería texto renderizado en una versión más avanzada)
-    std::cout << "Arquero: 25 oro | Mago: 50 oro | Artillero: 75 oro" << std::endl;
+    LOG_DEBUG("Arquero: 25 oro | Mago: 50 oro | Artillero: 75 oro");
 }
 
 void TowerManager::selectTowerType(TowerType type) {
     selectedType = type;
     selectedTower = nullptr; // Deseleccionar torre si hay alguna
-    std::cout << "Tipo de torre seleccionado: ";
-    
-    switch (type) {
-        case TowerType::ARCHER:
-            std::cout << "Arquero" << std::endl;
-            break;
-        case TowerType::MAGE:
-            std::cout << "Mago" << std::endl;
-            break;
-        case TowerType::ARTILLERY:
-            std::cout << "Artillero" << std::endl;
-            break;
-        case TowerType::NONE:
-            std::cout << "Ninguno" << std::endl;
-            break;
-    }
+    LOG_INFO("Tipo de torre seleccionado: %s", type == TowerType::NONE ? "Ninguno" : getTowerKind(type).name);
 }
 
 bool TowerManager::selectTowerAt(int row, int col) {
@@ -273,12 +293,12 @@ bool TowerManager::upgradeSelectedTower() {
     
     int cost = selectedTower->getUpgradeCost();
     if (!resources->spendGold(cost)) {
-        std::cout << "No hay suficiente oro para mejorar la torre" << std::endl;
+        LOG_INFO("No hay suficiente oro para mejorar la torre");
         return false;
     }
     
     if (selectedTower->upgrade()) {
-        std::cout << "¡Torre mejorada a nivel " << selectedTower->getLevel() << "!" << std::endl;
+        LOG_INFO("¡Torre mejorada a nivel %d!", selectedTower->getLevel());
         return true;
     }
     
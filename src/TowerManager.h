@@ -3,16 +3,17 @@
 
 #include <vector>
 #include <memory>
+#include <cstdint>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include "Tower.h"
 #include "ResourceSystem.h"
 
-enum class TowerType {
-    NONE,
-    ARCHER,
-    MAGE,
-    ARTILLERY
+// Torre colocada en el tablero (para copiar la disposición a otra simulación)
+struct TowerPlacement {
+    TowerType type;
+    int row, col;
+    int level;
 };
 
 class TowerManager {
@@ -22,6 +23,10 @@ private:
     Tower* selectedTower;
     ResourceSystem* resources;
     
+    // Semilla de sesión y número de torres creadas (cada torre tiene su propio flujo aleatorio)
+    uint64_t seed;
+    uint64_t towersCreated;
+    
     // Texturas para cada tipo de torre
     SDL_Texture* archerTexture;
     SDL_Texture* mageTexture;
@@ -31,7 +36,7 @@ private:
     void renderTowerMenu(SDL_Renderer* renderer) const;
     
 public:
-    TowerManager(ResourceSystem* res, SDL_Renderer* renderer);
+    TowerManager(ResourceSystem* res, SDL_Renderer* renderer, uint64_t seed = 0);
     ~TowerManager();
     
     // Cargar texturas para las torres
@@ -40,6 +45,12 @@ public:
     // Crear una nueva torre en la posición especificada
     bool createTower(int row, int col);
     
+    // Añadir una torre sin cobrar oro (reconstruir una disposición guardada)
+    bool addTower(TowerType type, int row, int col, int level = 1);
+    
+    // Disposición actual de las torres
+    std::vector<TowerPlacement> getLayout() const;
+    
     // Actualizar todas las torres
     void update(int deltaTime);
     
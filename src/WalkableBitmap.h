@@ -0,0 +1,65 @@
+#ifndef WALKABLE_BITMAP_H
+#define WALKABLE_BITMAP_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Celdas caminables del tablero con un bit por celda. Cada fila empieza en una
+// palabra de 64 bits nueva, así las operaciones por filas trabajan con palabras
+// enteras y copiar el mapa es copiar un bloque de memoria (un tablero de
+// 1000x1000 ocupa unos 125 KB). Es lo que consumen los buscadores de caminos:
+// bitmap(x, y) sirve directamente como predicado de AStar.
+class WalkableBitmap {
+private:
+    int rows;
+    int cols;
+    int wordsPerRow;
+    std::vector<uint64_t> words;  // Fila a fila; bit x % 64 de la palabra x / 64
+
+public:
+    WalkableBitmap() : rows(0), cols(0), wordsPerRow(0) {}
+
+    WalkableBitmap(int r, int c) : rows(0), cols(0), wordsPerRow(0) {
+        reset(r, c);
+    }
+
+    // Cambia las dimensiones y deja todas las celdas como no caminables
+    void reset(int r, int c) {
+        rows = r;
+        cols = c;
+        wordsPerRow = (c + 63) / 64;
+        words.assign(static_cast<size_t>(rows) * wordsPerRow, 0);
+    }
+
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getWordsPerRow() const { return wordsPerRow; }
+
+    // Sin comprobar límites (como el acceso a un vector)
+    bool isWalkable(int x, int y) const {
+        return (words[static_cast<size_t>(y) * wordsPerRow + (x >> 6)] >> (x & 63)) & 1;
+    }
+
+    bool operator()(int x, int y) const { return isWalkable(x, y); }
+
+    void set(int x, int y, bool walkable) {
+        uint64_t& word = words[static_cast<size_t>(y) * wordsPerRow + (x >> 6)];
+        uint64_t bit = uint64_t(1) << (x & 63);
+        word = walkable ? (word | bit) : (word & ~bit);
+    }
+
+    // Palabras de la fila y (los bits por encima de cols siempre valen 0)
+    const uint64_t* getRow(int y) const { return words.data() + static_cast<size_t>(y) * wordsPerRow; }
+    uint64_t* getRow(int y) { return words.data() + static_cast<size_t>(y) * wordsPerRow; }
+
+    const std::vector<uint64_t>& getWords() const { return words; }
+
+    bool operator==(const WalkableBitmap& other) const {
+        return rows == other.rows && cols == other.cols && words == other.words;
+    }
+
+    bool operator!=(const WalkableBitmap& other) const { return !(*this == other); }
+};
+
+#endif // WALKABLE_BITMAP_H
@@ -1,11 +1,193 @@
 #include "Game.h"
+#include "Simulation.h"
+#include "RandomStream.h"
+#include "FitnessEvaluator.h"
+#include "IslandModel.h"
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Logger.h"
+#include "Profiler.h"
+#include <vector>
+
+// Convierte "a,fila,col" (a = arquero, m = mago, r = artillero) en una torre
+static bool parseTower(const char* text, TowerPlacement& placement) {
+    char type = 0;
+    if (std::sscanf(text, "%c,%d,%d", &type, &placement.row, &placement.col) != 3) {
+        return false;
+    }
+
+    placement.level = 1;
+    switch (type) {
+        case 'a': placement.type = TowerType::ARCHER; return true;
+        case 'm': placement.type = TowerType::MAGE; return true;
+        case 'r': placement.type = TowerType::ARTILLERY; return true;
+        default: return false;
+    }
+}
+
+// Resultado del programa (no es un diagnóstico): se imprime siempre, sea cual
+// sea el nivel del logger, después de los mensajes que el logger tenga pendientes
+static void printResult(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+static void printResult(const char* format, ...) {
+    Logger::instance().flush();
+    va_list args;
+    va_start(args, format);
+    std::vprintf(format, args);
+    va_end(args);
+    std::fflush(stdout);
+}
+
+// Deja de perfilar y escribe la traza pedida con --profile
+static void finishProfile(const char* traceFile) {
+    if (traceFile) {
+        Profiler::instance().stop();
+        Profiler::instance().exportChromeTrace(traceFile);
+    }
+}
+
+// Ejecuta oleadas (o entrena generaciones) sin ventana ni renderer y muestra un resumen
+static int runHeadless(int waves, int generations, int islandCount, int threads, int tickMs, uint64_t seed,
+                       const std::vector<TowerPlacement>& towers, const char* traceFile) {
+    Simulation simulation(nullptr, 12, 16, 100, seed);
+
+    for (const TowerPlacement& tower : towers) {
+        if (!simulation.placeTower(tower.type, tower.row, tower.col, tower.level)) {
+            LOG_WARN("Posicion de torre invalida: (%d,%d)", tower.row, tower.col);
+        }
+    }
+
+    // Solo se mide el hilo principal (los evaluadores del entrenamiento no)
+    if (traceFile) {
+        Profiler::instance().start();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    long steps = 0;
+    if (generations > 0 && islandCount > 1) {
+        FitnessEvaluator evaluator(threads, 120000, tickMs);
+        IslandModel islands(islandCount, 20, 5, 2, seed);
+        simulation.trainIslands(evaluator, islands, generations);
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        finishProfile(traceFile);
+        printResult("Headless: %d generaciones en %d islas en %g s | Fitness: Prom=%g Mejor=%g Peor=%g | Mutaciones: %d\n",
+                    generations, islands.getIslandCount(), seconds, islands.getAverageFitness(),
+                    islands.getBestFitness(), islands.getWorstFitness(), islands.getMutationsOccurred());
+        return 0;
+    } else if (generations > 0) {
+        FitnessEvaluator evaluator(threads, 120000, tickMs);
+        simulation.trainGenerations(evaluator, generations);
+    } else {
+        steps = simulation.runWaves(waves, tickMs);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    finishProfile(traceFile);
+
+    EnemyManager* enemyManager = simulation.getEnemyManager();
+    char summary[128];
+    if (generations > 0) {
+        std::snprintf(summary, sizeof(summary), "%d generaciones entrenadas en %g s", generations, seconds);
+    } else {
+        std::snprintf(summary, sizeof(summary), "%d oleadas, %ld pasos en %g s", waves, steps, seconds);
+    }
+    printResult("Headless: %s | Generacion: %d | Fitness: Prom=%g Mejor=%g | Oro: %d\n",
+                summary, enemyManager->getCurrentGeneration(), enemyManager->getAverageFitness(),
+                enemyManager->getBestFitness(), simulation.getResources()->getGold());
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    bool headless = false;
+    int waves = 10;
+    int generations = 0;
+    int threads = 0;
+    int islandCount = 1;
+    std::vector<TowerPlacement> towers;
+    int tickMs = Simulation::DEFAULT_TICK_MS;
+    int maxCatchUp = 10;
+    float speed = 1.0f;
+    uint64_t seed = 0;
+    bool hasSeed = false;
+    const char* traceFile = nullptr;
+
+    // Argumentos: --headless [--waves N | --train N [--threads T] [--islands K]] [--tower a,fila,col]...
+    //             [--tick MS] [--catchup N] [--speed X] [--seed S] [--log trace|debug|info|warn|error]
+    //             [--profile traza.json]
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--waves") == 0 && i + 1 < argc) {
+            waves = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--train") == 0 && i + 1 < argc) {
+            generations = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--islands") == 0 && i + 1 < argc) {
+            islandCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--tower") == 0 && i + 1 < argc) {
+            TowerPlacement placement;
+            if (parseTower(argv[++i], placement)) {
+                towers.push_back(placement);
+            }
+        } else if (std::strcmp(argv[i], "--tick") == 0 && i + 1 < argc) {
+            tickMs = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--catchup") == 0 && i + 1 < argc) {
+            maxCatchUp = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+            // Un multiplicador <= 0 (o que no es un número) pararía el bucle de paso fijo
+            const char* text = argv[++i];
+            char* end = nullptr;
+            speed = std::strtof(text, &end);
+            if (end == text || *end != '\0' || !std::isfinite(speed) || speed <= 0.0f) {
+                std::fprintf(stderr, "Velocidad invalida: %s (debe ser un numero mayor que 0)\n", text);
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+            hasSeed = true;
+        } else if (std::strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            // Nivel en tiempo de ejecución (los compilados fuera no se pueden activar)
+            LogLevel level;
+            if (Logger::parseLevel(argv[++i], level)) {
+                Logger::instance().setLevel(level);
+            }
+        } else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            // Perfilar desde el inicio y escribir la traza (JSON de Chrome) al terminar
+            traceFile = argv[++i];
+        }
+    }
+
+    // Sin semilla explícita se elige una al azar; se muestra para poder repetir la partida
+    if (!hasSeed) {
+        seed = RandomStream::randomSeed();
+    }
+    printResult("Semilla de la sesion: %llu\n", static_cast<unsigned long long>(seed));
+
+    if (tickMs <= 0) {
+        tickMs = Simulation::DEFAULT_TICK_MS;
+    }
+
+    if (headless) {
+        return runHeadless(waves, generations, islandCount, threads, tickMs, seed, towers, traceFile);
+    }
 
-int main(int, char**) {
     Game game;
-    
+    game.setTimestep(tickMs, maxCatchUp);
+    game.setSpeedMultiplier(speed);
+    game.setSeed(seed);
+    if (traceFile) {
+        game.setProfileOutput(traceFile);
+    }
+
     if (game.initialize()) {
         game.run();
     }
-    
+
     return 0;
-}
\ No newline at end of file
+}